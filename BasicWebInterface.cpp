@@ -3,6 +3,8 @@
 #include <ESPmDNS.h>
 #include "WebStatus.h"
 #include "WebAuthPlugin.h"
+#include "WebRuntime.h"
+#include "StaticAssets.h"
 
 void BasicWebInterface::begin(bool authEnabled, bool postOnlyLockdown) {
 
@@ -20,94 +22,357 @@ void BasicWebInterface::begin(bool authEnabled, bool postOnlyLockdown) {
     //setup other routes
     setupRoutes();
 }
-void BasicWebInterface::setupRoutes() {
-    server.on("/", HTTP_GET, [this]() {
-        server.send(200, "text/html", generateHTML());
-    });
+bool BasicWebInterface::startTask(uint32_t stackSize, UBaseType_t priority, BaseType_t core) {
+    if (task_) return true;
+    if (xTaskCreatePinnedToCore(taskMain_, "webServer", stackSize, this,
+                                priority, &task_, core) != pdPASS) {
+        task_ = nullptr;
+        gLogger->println("BasicWebInterface: Failed to start task");
+        return false;
+    }
+    return true;
+}
+
+void BasicWebInterface::taskMain_(void* arg) {
+    auto* self = static_cast<BasicWebInterface*>(arg);
+    for (;;) {
+        self->serve_();
+        vTaskDelay(1);   // idle between polls; lets lower-priority tasks run
+    }
+}
 
+void BasicWebInterface::setupRoutes() {
+    // fixed paths go through one hashed table, registered ahead of the
+    // handlers of web items and the event stream
+    routes_ = new RouteTable([this](const RouteTable::Route& r) { dispatch_(r); });
+    routes_->add("/", HTTP_GET, kRoot_);
+    for (size_t i = 0; i < StaticAssets::kRoutedCount; ++i) {
+        const StaticAssets::Asset* a = StaticAssets::kRouted[i];
+        routes_->add(a->url, HTTP_GET, kAsset_, const_cast<StaticAssets::Asset*>(a));
+    }
     for (auto& kv : displays_) {
-        auto* disp = kv.second;
-        server.on(disp->handle(), HTTP_GET, [this, disp]() {
-            server.send(200, "application/json", disp->routeText());
-        });
+        WebDisplayBase* disp = kv.second;
+        routes_->add(disp->handle(), HTTP_GET, kDisplay_, disp);
+        if (disp->history()) {
+            routes_->add(disp->handle() + "/history", HTTP_GET, kHistory_, disp);
+        }
     }
-    for(const auto& settingsDisplay : settingsDisplays_) {
-        settingsDisplay.second->setupRoutes(server);
+    routes_->add("/displays.json", HTTP_GET, kDisplaysJson_);
+    if (sparkIntervalMs_()) {
+        routes_->add("/histories.json", HTTP_GET, kHistoriesJson_);
+    }
+    for (auto& kv : settingsDisplays_) {
+        SettingsBlockBase* block = kv.second;
+        const String url = block->url();
+        routes_->add(url,             HTTP_GET,  kSettingsForm_,       block);
+        routes_->add(url + "/update", HTTP_POST, kSettingsUpdate_,     block);
+        routes_->add(url + ".json",   HTTP_GET,  kSettingsJson_,       block);
+        routes_->add(url + ".json",   HTTP_POST, kSettingsJsonUpdate_, block);
+    }
+    if (combinedSettings_) {
+        routes_->add("/settings/update", HTTP_POST, kCombinedSettings_);
+    }
+    routes_->add("/status", HTTP_GET, kStatus_);
+    routes_->add("/log",    HTTP_GET, kLog_);
+    server.addHandler(routes_);
+
+    if (eventsEnabled_) {
+        // the status panel rides on the stream as well (polling is its fallback)
+        events_.addFeed("status", 5000, [](ChunkedWriter& w) { WebStatus::writeSystemStatus(w); });
+        events_.addDeltaFeed("log", 1000, WebStatus::writeLogTextSince, WebStatus::logVersion);
+        if (const uint32_t iv = sparkIntervalMs_()) {
+            events_.addFeed("history", iv, [this](ChunkedWriter& w) { writeHistoriesJson_(w); });
+        }
+        events_.setupRoutes(server, displays_);
     }
     //web items
     for(auto* item : webItems_) {
         item->setupRoutes(server);
     }
 
-    // System status route (return JSON)
-    server.on("/status", HTTP_GET, [this]() {
-        server.send(200, "application/json", WebStatus::getSystemStatus());
-    });
-
-    // Log route (for dynamic log updates)
-    server.on("/log", HTTP_GET, [this]() {
-        server.send(200, "text/plain", WebStatus::createLogText());
-    });
-
     server.onNotFound([this]() {
         server.send(404, "text/plain", "Not Found");
     });
 }
 
+void BasicWebInterface::dispatch_(const RouteTable::Route& r) {
+    switch (r.kind) {
+        case kRoot_: {
+            ServerChunkWriter w(server);
+            w.begin(200, "text/html");
+            writeHTML(w);
+            w.end();
+            break;
+        }
+        case kAsset_:
+            StaticAssets::send(server, *static_cast<const StaticAssets::Asset*>(r.target), true);
+            break;
+        case kDisplay_:
+            serveDisplay_(static_cast<WebDisplayBase*>(r.target));
+            break;
+        case kHistory_:
+            serveHistory_(*static_cast<WebDisplayBase*>(r.target)->history());
+            break;
+        case kDisplaysJson_:
+            serveDisplaysJson_();
+            break;
+        case kHistoriesJson_: {
+            server.sendHeader("Cache-Control", "no-store");
+            ServerChunkWriter w(server);
+            w.begin(200, "application/json");
+            writeHistoriesJson_(w);
+            w.end();
+            break;
+        }
+        case kSettingsForm_:
+            static_cast<SettingsBlockBase*>(r.target)->streamHTML(server);
+            break;
+        case kSettingsUpdate_:
+            static_cast<SettingsBlockBase*>(r.target)->serveUpdate(server);
+            break;
+        case kSettingsJson_:
+            static_cast<SettingsBlockBase*>(r.target)->serveJson(server);
+            break;
+        case kSettingsJsonUpdate_:
+            static_cast<SettingsBlockBase*>(r.target)->serveJsonUpdate(server);
+            break;
+        case kCombinedSettings_:
+            handleCombinedSettingsPost_();
+            break;
+        case kStatus_: {
+            // System status (JSON, or CBOR on request)
+            const bool cbor = wantsCbor_();
+            server.sendHeader("Vary", "Accept");
+            ServerChunkWriter w(server);
+            w.begin(200, cbor ? "application/cbor" : "application/json");
+            WebStatus::writeSystemStatus(w, cbor);
+            w.end();
+            break;
+        }
+        case kLog_: {
+            // Log (for dynamic log updates)
+            ServerChunkWriter w(server);
+            w.begin(200, "text/plain");
+            WebStatus::writeLogText(w);
+            w.end();
+            break;
+        }
+    }
+}
 
-String BasicWebInterface::generateHeaderAndStatusHtml() const{
-    String html = R"(
-    <!DOCTYPE html>
-    <html>
-    <head>
-    <meta charset="UTF-8">
-    <title>ESP32 )" + systemID.systemName() + R"( Control</title>
-    </head>
-    <body>
-    <h2>System Status</h2>
-    )";
+void BasicWebInterface::serveDisplay_(WebDisplayBase* disp) {
+    const bool cbor = wantsCbor_();
+    // displays that track changes revalidate by ETag: the browser's
+    // cached copy is reused (304) until update() bumps the version. A
+    // request that lands inside an update goes out without one: that
+    // version is shared by every update in flight, whatever its value
+    uint32_t version;
+    if (disp->tracksChanges() && disp->settledVersion(version)) {
+        char token[24], tag[32];
+        versionToken_(token, sizeof(token), version);
+        snprintf(tag, sizeof(tag), cbor ? "\"%s-cbor\"" : "\"%s\"", token);
+        server.sendHeader("ETag", tag);
+        server.sendHeader("Vary", "Accept");
+        server.sendHeader("Cache-Control", "no-cache");
+        if (server.header("If-None-Match") == tag) {
+            server.send(304);
+            return;
+        }
+    }
+    ServerChunkWriter w(server);
+    w.begin(200, cbor ? "application/cbor" : "application/json");
+    if (cbor) disp->writeCbor(w);
+    else      disp->writeJson(w);
+    w.end();
+}
 
-    html += WebStatus::createSystemStatHtmlFragment();
-    return html;
+void BasicWebInterface::serveHistory_(const DisplayHistoryBase& hist) {
+    const uint8_t level = server.hasArg("level") ? (uint8_t)server.arg("level").toInt()
+                                                 : hist.sparkLevel();
+    ServerChunkWriter w(server);
+    w.begin(200, "application/json");
+    hist.writeJson(w, level, millis());
+    w.end();
 }
 
-String BasicWebInterface::generateDisplayHtml() const{
+// all polled displays in one response: {"<id>":<writeJson>, ...}
+// ?since=<X-Display-Seq of an earlier answer> leaves out displays that did
+// not change since then (displays without change tracking are always sent)
+void BasicWebInterface::serveDisplaysJson_() {
+    uint32_t since = 0;
+    if (server.hasArg("since")) {
+        since = parseVersionToken_(server.arg("since"));
+    }
+    char seq[24];
+    versionToken_(seq, sizeof(seq), WebDisplayBase::changeSeq());
+    server.sendHeader("X-Display-Seq", seq);
+    server.sendHeader("Cache-Control", "no-store");
+    ServerChunkWriter w(server);
+    w.begin(200, "application/json");
+    writeDisplaysJson_(w, since);
+    w.end();
+}
+
+String BasicWebInterface::collect_(void (BasicWebInterface::*section)(ChunkedWriter&) const) const {
     String html;
-    html.reserve(1024);
+    StringChunkWriter w(html);
+    (this->*section)(w);
+    w.flush();
+    return html;
+}
+
+void BasicWebInterface::writeHeaderAndStatusHtml(ChunkedWriter& w) const{
+    w.write(F("<!DOCTYPE html>\n"
+              "<html>\n"
+              "<head>\n"
+              "<meta charset=\"UTF-8\">\n"
+              "<title>ESP32 "));
+    w.writeHtmlEscaped(systemID.systemName());
+    w.write(F(" Control</title>\n"
+              "</head>\n"
+              "<body>\n"
+              "<h2>System Status</h2>\n"));
+    WebStatus::writeSystemStatHtmlFragment(w);
+}
+
+// machine clients ask for CBOR with ?fmt=cbor or "Accept: application/cbor"
+bool BasicWebInterface::wantsCbor_() {
+    if (server.hasArg("fmt")) return server.arg("fmt") == "cbor";
+    return server.header("Accept").indexOf("application/cbor") >= 0;
+}
+
+// "<boot tag hex>-<version>": versions restart at 0 after a reboot, the boot
+// tag makes sure an old token is not mistaken for a current one
+void BasicWebInterface::versionToken_(char* buf, size_t len, uint32_t version) {
+    snprintf(buf, len, "%08x-%u", (unsigned)WebDisplayBase::bootTag(), (unsigned)version);
+}
+
+// version encoded in 'token', or 0 (= everything) if it is from another boot
+uint32_t BasicWebInterface::parseVersionToken_(const String& token) {
+    char* end = nullptr;
+    const uint32_t boot = strtoul(token.c_str(), &end, 16);
+    if (!end || *end != '-' || boot != WebDisplayBase::bootTag()) return 0;
+    return strtoul(end + 1, nullptr, 10);
+}
+
+void BasicWebInterface::writeDisplaysJson_(ChunkedWriter& w, uint32_t since) const {
+    JsonWriter j(w);
+    j.beginObject();
     for (const auto& display : displays_) {
-        if(display.first.length() > 0) {
-            html += "<h3>" + display.first + "</h3>";
-        }
-        html += display.second->createHtmlFragment();
+        const WebDisplayBase* d = display.second;
+        if (d->updateInterval() == 0) continue;   // not polled (e.g. buttons: their route is an action)
+        if (since && d->tracksChanges() && d->version() <= since) continue;
+        j.key(d->id());
+        d->writeValue(j);
     }
-    return html;
+    j.endObject();
 }
-String BasicWebInterface::generateSettingsHtml() const{
-    String html;
-    html.reserve(1024);
-    for(const auto& settingsDisplay : settingsDisplays_) {
-        html += "<h3>" + settingsDisplay.first + "</h3>";
-        html += settingsDisplay.second->generateHTML();
+
+// every sparkline in one object: {"<id>":<history at its sparkLevel>, ...}
+void BasicWebInterface::writeHistoriesJson_(ChunkedWriter& w) const {
+    const uint32_t now = millis();
+    JsonWriter j(w);
+    j.beginObject();
+    for (const auto& display : displays_) {
+        const DisplayHistoryBase* hist = display.second->history();
+        if (!hist) continue;
+        j.key(display.second->id());
+        hist->writeJson(j, hist->sparkLevel(), now);
     }
-    return html;
+    j.endObject();
+}
 
+// shortest sparkline redraw interval (0: no display has a history)
+uint32_t BasicWebInterface::sparkIntervalMs_() const {
+    uint32_t iv = 0;
+    for (const auto& display : displays_) {
+        const DisplayHistoryBase* hist = display.second->history();
+        if (hist && (!iv || hist->sparkIntervalMs() < iv)) iv = hist->sparkIntervalMs();
+    }
+    return iv;
 }
-String BasicWebInterface::generateWebItemsHtml() const{
-    String html;
-    html.reserve(1024);
-    for(auto* item : webItems_) {
-        html += item->generateHTML();
+
+// fragments are still built one at a time as Strings; each is freed before
+// the next, so only the largest single widget is ever on the heap
+void BasicWebInterface::writeDisplayHtml(ChunkedWriter& w) const{
+    if (!displays_.empty()) {
+        w.write(WebRuntime::headTags(eventsEnabled_));
     }
-    return html;
+    for (const auto& display : displays_) {
+        const String desc = desc_(display.first);
+        if(desc.length() > 0) {
+            w.write(F("<h3>"));
+            w.write(desc);
+            w.write(F("</h3>"));
+        }
+        w.write(display.second->createHtmlFragment());
+        if (const DisplayHistoryBase* hist = display.second->history()) {
+            w.write(hist->createSparklineHtml(display.second->id()));
+        }
+    }
+}
+// field names in the combined form are prefixed "b<index>." so that equal
+// keys in different blocks do not collide
+static void settingsScope_(char* buf, size_t len, size_t index) {
+    snprintf(buf, len, "b%u.", (unsigned)index);
+}
+
+void BasicWebInterface::writeSettingsHtml(ChunkedWriter& w) const{
+    if (!combinedSettings_) {
+        for(const auto& settingsDisplay : settingsDisplays_) {
+            w.write(F("<h3>"));
+            w.write(desc_(settingsDisplay.first));
+            w.write(F("</h3>"));
+            settingsDisplay.second->writeHTML(w);
+        }
+        return;
+    }
+    if (settingsDisplays_.empty()) return;
+
+    w.write(F("<form method='POST' action='/settings/update'>\n"));
+    char scope[12];
+    for (size_t i = 0; i < settingsDisplays_.size(); ++i) {
+        w.write(F("<h3>"));
+        w.write(desc_(settingsDisplays_[i].first));
+        w.write(F("</h3>\n"));
+        settingsScope_(scope, sizeof(scope), i);
+        w.setFieldPrefix(scope);
+        settingsDisplays_[i].second->writeInputs(w);
+    }
+    w.setFieldPrefix(nullptr);
+    if (!WebAuthPlugin::instance().isActive()) {
+        w.write(F("Password: <input type='password' name='pw'><br><br>\n"));
+    }
+    w.write(F("<input type='submit' value='Save all'></form>\n"));
 }
 
-String BasicWebInterface::generateHTML() const {
-    String html = generateHeaderAndStatusHtml();
+void BasicWebInterface::handleCombinedSettingsPost_() {
+    SettingsArgs args(server);   // one index for all blocks
+    if (!SettingsBlockBase::authorizePost(server, args, "/settings")) return;
 
-    html += generateDisplayHtml();
-    html += generateSettingsHtml();
-    html += generateWebItemsHtml();
-    html += generateFooterHtml();
+    // apply + sanity-check everything first, then persist
+    char scope[12];
+    for (size_t i = 0; i < settingsDisplays_.size(); ++i) {
+        settingsScope_(scope, sizeof(scope), i);
+        args.setScope(scope);
+        settingsDisplays_[i].second->applyPost(args);
+    }
+    for (auto& settingsDisplay : settingsDisplays_) {
+        settingsDisplay.second->commit();
+    }
+    server.sendHeader("Location", "/");
+    server.send(303);
+}
+void BasicWebInterface::writeWebItemsHtml(ChunkedWriter& w) const{
+    for(auto* item : webItems_) {
+        item->writeHTML(w);
+    }
+}
 
-    return html;
+void BasicWebInterface::writeHTML(ChunkedWriter& w) const {
+    writeHeaderAndStatusHtml(w);
+    writeDisplayHtml(w);
+    writeSettingsHtml(w);
+    writeWebItemsHtml(w);
+    writeFooterHtml(w);
 }
\ No newline at end of file
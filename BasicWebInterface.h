@@ -3,6 +3,8 @@
 #include <WebDisplay.h>
 #include <WebSettings.h>
 #include <WebItem.h>
+#include "DisplayEventStream.h"
+#include "RouteTable.h"
 
 #ifndef BASICWEBINTERFACE_H
 #define BASICWEBINTERFACE_H
@@ -13,17 +15,56 @@ public:
 
     BasicWebInterface(){}
     void begin(bool authEnabled = true, bool postOnlyLockdown = true);
+    // call from the sketch's loop(); does nothing once startTask() succeeded
     void loop(){
-        server.handleClient();
+        if (task_) return;
+        serve_();
     }
 
+    // Serve from a FreeRTOS task of its own instead of the sketch's loop():
+    // a slow client (OTA upload, stalled /log download) then holds up only
+    // this task, never the firmware loop. Requests are still served one at
+    // a time. Call after begin().
+    // Route handlers, button callbacks and settings observers without a task
+    // then run on the web task, concurrently with loop():
+    //  • display update()/publishLatest()/setMaxVal() (one updating task per
+    //    display) and attached histories are safe
+    //  • setDescText() is safe
+    //  • Setting<T>::value is written by POSTs on the web task: read it in
+    //    loop() through a SettingsSnapshot, or hold a SettingsBlockBase::Guard
+    //    while reading or changing values directly
+    //  • addDisplay()/addSettings()/addWebItem() only before begin()
+    bool startTask(uint32_t stackSize = 8192,
+                   UBaseType_t priority = 1,
+                   BaseType_t core = tskNO_AFFINITY);
+    TaskHandle_t task() const { return task_; }
+
     void setupRoutes();
+    // The root page is streamed through these in chunks of
+    // CHUNKED_WRITER_BUFFER_SIZE, so its size does not cost heap;
     // can override any of those to change the HTML output
-    virtual String generateHTML() const;
-    virtual String generateHeaderAndStatusHtml() const;
-    virtual String generateDisplayHtml() const;
-    virtual String generateSettingsHtml() const;
-    virtual String generateWebItemsHtml() const;
+    virtual void writeHTML(ChunkedWriter& w) const;
+    virtual void writeHeaderAndStatusHtml(ChunkedWriter& w) const;
+    virtual void writeDisplayHtml(ChunkedWriter& w) const;
+    virtual void writeSettingsHtml(ChunkedWriter& w) const;
+    virtual void writeWebItemsHtml(ChunkedWriter& w) const;
+    void writeFooterHtml(ChunkedWriter& w) const {
+        w.write(F("</body></html>"));
+    }
+
+    // The same sections collected into a String (e.g. to embed them elsewhere).
+    //
+    // API CHANGE: these used to be the virtual override points; the page is
+    // now rendered by the write*Html() functions above and never calls them.
+    // They are 'final' so that an old override (with or without 'override')
+    // fails to compile instead of being silently bypassed. To port one,
+    // override the matching write*Html() and send the String you built with
+    // w.write(html) – or better, write its parts to 'w' directly.
+    virtual String generateHTML() const final                { return collect_(&BasicWebInterface::writeHTML); }
+    virtual String generateHeaderAndStatusHtml() const final { return collect_(&BasicWebInterface::writeHeaderAndStatusHtml); }
+    virtual String generateDisplayHtml() const final         { return collect_(&BasicWebInterface::writeDisplayHtml); }
+    virtual String generateSettingsHtml() const final        { return collect_(&BasicWebInterface::writeSettingsHtml); }
+    virtual String generateWebItemsHtml() const final        { return collect_(&BasicWebInterface::writeWebItemsHtml); }
     String generateFooterHtml() const {
         return "</body></html>";
     }
@@ -38,11 +79,26 @@ public:
         webItems_.push_back(item);
     }
 
+    // one form for all settings blocks, posted to /settings/update: every block
+    // is applied and sanity-checked, then each saves its changes; one redirect.
+    // Call before begin().
+    void setCombinedSettingsForm(bool on) { combinedSettings_ = on; }
+
+    // push display changes over Server-Sent Events (/events); the page falls
+    // back to polling when the stream is unavailable. Call before begin().
+    void enableDisplayEvents(uint32_t coalesceMs = 250, size_t maxClients = 4) {
+        eventsEnabled_ = true;
+        events_.setCoalesceMs(coalesceMs);
+        events_.setMaxClients(maxClients);
+    }
+    DisplayEventStream& displayEvents() { return events_; }
+
+    // may be called from any task: the page copies the text under descMutex_
     void setDescText(const String& text, WebDisplayBase * which) {
         // find and set
         for (auto& p : displays_) {
             if (p.second == which) {
-                p.first = text;
+                setDesc_(p.first, text);
                 return;
             }
         }
@@ -53,7 +109,7 @@ public:
         // find and set
         for (auto& p : settingsDisplays_) {
             if (p.second == which) {
-                p.first = text;
+                setDesc_(p.first, text);
                 return;
             }
         }
@@ -67,6 +123,50 @@ private:
     std::vector<std::pair<String, WebDisplayBase*>> displays_;
     std::vector<std::pair<String, SettingsBlockBase*>> settingsDisplays_;
     std::vector<WebItem*> webItems_;
+    bool combinedSettings_ = false;
+    DisplayEventStream events_;
+    bool eventsEnabled_ = false;
+    TaskHandle_t task_ = nullptr;
+    SemaphoreHandle_t descMutex_ = xSemaphoreCreateMutex();   // guards the desc texts
+
+    void setDesc_(String& desc, const String& text) {
+        xSemaphoreTake(descMutex_, portMAX_DELAY);
+        desc = text;
+        xSemaphoreGive(descMutex_);
+    }
+    String desc_(const String& desc) const {
+        xSemaphoreTake(descMutex_, portMAX_DELAY);
+        String copy = desc;
+        xSemaphoreGive(descMutex_);
+        return copy;
+    }
+
+    void serve_(){
+        server.handleClient();
+        if (eventsEnabled_) events_.loop();
+    }
+    static void taskMain_(void* arg);
+
+    // route kinds in routes_; target: display / settings block / asset
+    enum RouteKind_ : uint8_t {
+        kRoot_, kAsset_, kDisplay_, kHistory_, kDisplaysJson_, kHistoriesJson_,
+        kSettingsForm_, kSettingsUpdate_, kSettingsJson_, kSettingsJsonUpdate_,
+        kCombinedSettings_, kStatus_, kLog_
+    };
+    RouteTable* routes_ = nullptr;   // created by setupRoutes(), owned by the server
+
+    void dispatch_(const RouteTable::Route& r);
+    void serveDisplay_(WebDisplayBase* disp);
+    void serveHistory_(const DisplayHistoryBase& hist);
+    void serveDisplaysJson_();
+    String collect_(void (BasicWebInterface::*section)(ChunkedWriter&) const) const;
+    void handleCombinedSettingsPost_();
+    void writeDisplaysJson_(ChunkedWriter& w, uint32_t since = 0) const;
+    void writeHistoriesJson_(ChunkedWriter& w) const;
+    uint32_t sparkIntervalMs_() const;
+    bool wantsCbor_();
+    static void versionToken_(char* buf, size_t len, uint32_t version);
+    static uint32_t parseVersionToken_(const String& token);
 
 };
 #endif
\ No newline at end of file
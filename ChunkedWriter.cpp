@@ -0,0 +1,160 @@
+#include "ChunkedWriter.h"
+#include "NumberFormat.h"
+#include <WebServer.h>
+
+void ChunkedWriter::write(const char* s, size_t n) {
+    while (n > 0) {
+        if (len_ == sizeof(buf_)) flush();
+        size_t take = sizeof(buf_) - len_;
+        if (take > n) take = n;
+        memcpy(buf_ + len_, s, take);
+        len_ += take;
+        s    += take;
+        n    -= take;
+    }
+}
+
+void ChunkedWriter::write(char c) {
+    if (len_ == sizeof(buf_)) flush();
+    buf_[len_++] = c;
+}
+
+void ChunkedWriter::writeInt(int32_t v) {
+    char tmp[NumberFormat::kBufSize];
+    write(tmp, NumberFormat::formatInt(tmp, v));
+}
+
+void ChunkedWriter::writeUInt(uint32_t v) {
+    char tmp[NumberFormat::kBufSize];
+    write(tmp, NumberFormat::formatUInt(tmp, v));
+}
+
+void ChunkedWriter::writeInt64(int64_t v) {
+    char tmp[NumberFormat::kBufSize];
+    write(tmp, NumberFormat::formatInt64(tmp, v));
+}
+
+void ChunkedWriter::writeUInt64(uint64_t v) {
+    char tmp[NumberFormat::kBufSize];
+    write(tmp, NumberFormat::formatUInt64(tmp, v));
+}
+
+void ChunkedWriter::writeFloat(float v, unsigned precision) {
+    char tmp[NumberFormat::kBufSize];
+    write(tmp, NumberFormat::formatFloat(tmp, v, precision));
+}
+
+void ChunkedWriter::writeDouble(double v, unsigned precision) {
+    char tmp[NumberFormat::kBufSize];
+    write(tmp, NumberFormat::formatDouble(tmp, v, precision));
+}
+
+void ChunkedWriter::writeHtmlEscaped(const char* s) {
+    if (!s) return;
+    const char* run = s;   // start of the not-yet-written plain run
+    for (; *s; ++s) {
+        const char* ent = nullptr;
+        switch (*s) {
+            case '&':  ent = "&amp;";  break;
+            case '<':  ent = "&lt;";   break;
+            case '>':  ent = "&gt;";   break;
+            case '"':  ent = "&quot;"; break;
+            case '\'': ent = "&#39;";  break;
+            default: continue;
+        }
+        write(run, (size_t)(s - run));
+        write(ent);
+        run = s + 1;
+    }
+    write(run, (size_t)(s - run));
+}
+
+void ChunkedWriter::writeJsonString(const char* s) {
+    write('"');
+    if (s) {
+        const char* run = s;
+        for (; *s; ++s) {
+            const unsigned char c = (unsigned char)*s;
+            if (c != '"' && c != '\\' && c >= 0x20) continue;
+            write(run, (size_t)(s - run));
+            switch (c) {
+                case '"':  write(F("\\\"")); break;
+                case '\\': write(F("\\\\")); break;
+                case '\n': write(F("\\n"));  break;
+                case '\r': write(F("\\r"));  break;
+                case '\t': write(F("\\t"));  break;
+                default: {
+                    char tmp[7];
+                    snprintf(tmp, sizeof(tmp), "\\u%04x", c);
+                    write(tmp, 6);
+                }
+            }
+            run = s + 1;
+        }
+        write(run, (size_t)(s - run));
+    }
+    write('"');
+}
+
+void ChunkedWriter::writeFieldName(const char* key, int index) {
+    write(fieldPrefix_);
+    write(key);
+    if (index >= 0) {
+        write('_');
+        writeUInt((uint32_t)index);
+    }
+}
+
+void ChunkedWriter::flush() {
+    if (len_ == 0) return;
+    emit_(buf_, len_);
+    total_ += len_;
+    len_ = 0;
+}
+
+//----------------------------------------------------------------------------
+// BufferChunkWriter
+//----------------------------------------------------------------------------
+void BufferChunkWriter::emit_(const char* data, size_t n) {
+    if (!size_) { overflowed_ = overflowed_ || n; return; }
+    const size_t room = size_ - 1 - used_;
+    if (n > room) { n = room; overflowed_ = true; }
+    memcpy(buf_ + used_, data, n);
+    used_ += n;
+    buf_[used_] = 0;
+}
+
+//----------------------------------------------------------------------------
+// ServerChunkWriter
+//----------------------------------------------------------------------------
+void ServerChunkWriter::begin(int code, const char* contentType) {
+    code_        = code;
+    contentType_ = contentType;
+    open_        = true;
+    ending_ = sent_ = chunked_ = false;
+}
+
+void ServerChunkWriter::end() {
+    if (!open_) return;
+    ending_ = true;
+    flush();
+    if (!sent_) {
+        srv_.send(code_, contentType_, "");   // empty body
+    } else if (chunked_) {
+        srv_.sendContent("");   // zero-length chunk terminates the body
+    }
+    open_ = false;
+}
+
+void ServerChunkWriter::emit_(const char* data, size_t n) {
+    if (!open_) return;
+    if (!sent_) {
+        // the whole body is in this piece when end() flushes before anything
+        // went out; otherwise the length is still unknown
+        chunked_ = !ending_;
+        srv_.setContentLength(chunked_ ? CONTENT_LENGTH_UNKNOWN : n);
+        srv_.send(code_, contentType_, "");
+        sent_ = true;
+    }
+    srv_.sendContent(data, n);
+}
@@ -0,0 +1,125 @@
+// -----------------------------------------------------------------------------
+// ChunkedWriter.h  – small fixed-buffer output path for generated HTML
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+
+class WebServer;
+
+// Size of the staging buffer every writer carries (on the stack, usually).
+// Larger values mean fewer sendContent() calls, smaller values less stack.
+#ifndef CHUNKED_WRITER_BUFFER_SIZE
+#define CHUNKED_WRITER_BUFFER_SIZE 256
+#endif
+
+/**
+ * Collects output in a fixed buffer and hands it to emit_() whenever the
+ * buffer is full (or on flush()). Renderers write pieces directly instead of
+ * concatenating temporary Strings, so peak memory is bounded by the buffer.
+ */
+class ChunkedWriter {
+public:
+    virtual ~ChunkedWriter() {}
+
+    void write(const char* s)                  { if (s) write(s, strlen(s)); }
+    void write(const char* s, size_t n);
+    void write(const String& s)                { write(s.c_str(), s.length()); }
+    void write(const __FlashStringHelper* s)   { write(reinterpret_cast<const char*>(s)); }
+    void write(char c);
+
+    void writeInt(int32_t v);
+    void writeUInt(uint32_t v);
+    void writeInt64(int64_t v);
+    void writeUInt64(uint64_t v);
+    void writeFloat(float v, unsigned precision);
+    void writeDouble(double v, unsigned precision);
+    void writeBool(bool v)                     { write(v ? F("true") : F("false")); }
+
+    /** writes s with &, <, >, " and ' replaced by entities (for attribute values) */
+    void writeHtmlEscaped(const char* s);
+    void writeHtmlEscaped(const String& s) { writeHtmlEscaped(s.c_str()); }
+
+    /** writes s as a quoted JSON string literal */
+    void writeJsonString(const char* s);
+    void writeJsonString(const String& s) { writeJsonString(s.c_str()); }
+
+    /** form field name: "key" or "key_<index>" for array elements,
+        preceded by the field prefix if one is set */
+    void writeFieldName(const char* key, int index = -1);
+    /** prefix for writeFieldName() (e.g. "b1." when several blocks share a form) */
+    void setFieldPrefix(const char* prefix) { fieldPrefix_ = prefix; }
+    const char* fieldPrefix() const         { return fieldPrefix_; }
+
+    void flush();
+    size_t bytesWritten() const { return total_ + len_; }
+
+protected:
+    virtual void emit_(const char* data, size_t n) = 0;
+
+private:
+    char   buf_[CHUNKED_WRITER_BUFFER_SIZE];
+    size_t len_   = 0;
+    size_t total_ = 0;
+    const char* fieldPrefix_ = nullptr;
+};
+
+// Appends into an Arduino String (keeps the String-returning APIs working).
+class StringChunkWriter : public ChunkedWriter {
+public:
+    explicit StringChunkWriter(String& out) : out_(out) {}
+    ~StringChunkWriter() override { flush(); }
+
+protected:
+    void emit_(const char* data, size_t n) override { out_.concat(data, n); }
+
+private:
+    String& out_;
+};
+
+// Writes into a caller-supplied buffer (no heap); output that does not fit
+// is dropped and reported by overflowed(). The text is kept NUL-terminated.
+class BufferChunkWriter : public ChunkedWriter {
+public:
+    BufferChunkWriter(char* buf, size_t size) : buf_(buf), size_(size) { if (size_) buf_[0] = 0; }
+    ~BufferChunkWriter() override { flush(); }
+
+    /** flushes and returns the text written so far */
+    const char* c_str()    { flush(); return buf_; }
+    size_t      length()   { flush(); return used_; }
+    bool        overflowed() const { return overflowed_; }
+
+protected:
+    void emit_(const char* data, size_t n) override;
+
+private:
+    char*  buf_;
+    size_t size_;
+    size_t used_       = 0;
+    bool   overflowed_ = false;
+};
+
+// Streams to the current WebServer response. Status and headers go out with
+// the first data: a body that fits the staging buffer is sent in one piece
+// with a Content-Length, anything longer uses chunked transfer encoding.
+class ServerChunkWriter : public ChunkedWriter {
+public:
+    explicit ServerChunkWriter(WebServer& srv) : srv_(srv) {}
+    ~ServerChunkWriter() override { end(); }
+
+    /** sets status + content type for the response */
+    void begin(int code, const char* contentType);
+    /** flushes the buffer and completes the response */
+    void end();
+
+protected:
+    void emit_(const char* data, size_t n) override;
+
+private:
+    WebServer&  srv_;
+    const char* contentType_ = nullptr;
+    int         code_        = 200;
+    bool        open_        = false;
+    bool        ending_      = false;   // inside end(): the last piece is being emitted
+    bool        sent_        = false;   // status + headers are out
+    bool        chunked_     = false;
+};
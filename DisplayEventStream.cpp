@@ -0,0 +1,162 @@
+#include "DisplayEventStream.h"
+#include "ChunkedWriter.h"
+
+namespace {
+
+// writes straight to the event-stream socket and remembers short writes
+class ClientWriter : public ChunkedWriter {
+public:
+    explicit ClientWriter(WiFiClient& c) : c_(c) {}
+    ~ClientWriter() override { flush(); }
+    bool failed() const { return failed_; }
+
+protected:
+    void emit_(const char* data, size_t n) override {
+        if (!failed_ && c_.write(reinterpret_cast<const uint8_t*>(data), n) != n) failed_ = true;
+    }
+
+private:
+    WiFiClient& c_;
+    bool        failed_ = false;
+};
+
+// event payload: every line break starts a new "data: " line (the browser
+// joins them with "\n" again)
+class EventDataWriter : public ChunkedWriter {
+public:
+    explicit EventDataWriter(ChunkedWriter& out) : out_(out) {}
+    ~EventDataWriter() override { flush(); }
+
+protected:
+    void emit_(const char* data, size_t n) override {
+        const char* run = data;
+        for (const char* p = data; p < data + n; ++p) {
+            if (*p != '\n' && *p != '\r') continue;
+            out_.write(run, (size_t)(p - run));
+            if (*p == '\n') out_.write(F("\ndata: "));
+            run = p + 1;
+        }
+        out_.write(run, (size_t)(data + n - run));
+    }
+
+private:
+    ChunkedWriter& out_;
+};
+
+} // namespace
+
+void DisplayEventStream::addFeed(const char* name, uint32_t intervalMs, FeedWriter write,
+                                 FeedVersion version) {
+    feeds_.push_back(Feed_{name, intervalMs, std::move(write), std::move(version), nullptr});
+}
+
+void DisplayEventStream::addDeltaFeed(const char* name, uint32_t intervalMs, FeedDelta write,
+                                      FeedVersion version) {
+    feeds_.push_back(Feed_{name, intervalMs, nullptr, std::move(version), std::move(write)});
+}
+
+void DisplayEventStream::setupRoutes(WebServer& srv, const DisplayList& displays) {
+    displays_ = &displays;
+    srv.on("/events", HTTP_GET, [this, &srv]() {
+        accept_(srv);
+    });
+}
+
+void DisplayEventStream::accept_(WebServer& srv) {
+    if (clients_.size() >= maxClients_) {
+        // EventSource gives up on a non-200 answer; the page keeps polling
+        srv.send(503, "text/plain", "too many event clients");
+        return;
+    }
+    Client_ c;
+    c.client = srv.client();   // shares the socket; it stays open while we hold it
+    c.client.setNoDelay(true);
+    c.sentVersion.assign(displays_->size(), 0);
+    c.sentMs.assign(displays_->size(), 0);
+    c.feedVersion.assign(feeds_.size(), 0);
+    c.feedMs.assign(feeds_.size(), 0);
+
+    static const char kHeader[] =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/event-stream\r\n"
+        "Cache-Control: no-cache\r\n"
+        "Connection: keep-alive\r\n"
+        "\r\n"
+        "retry: 3000\n\n";
+    if (c.client.write(reinterpret_cast<const uint8_t*>(kHeader), sizeof(kHeader) - 1) != sizeof(kHeader) - 1) {
+        return;
+    }
+    c.connectedMs = c.lastWriteMs = millis();
+    clients_.push_back(std::move(c));
+    // no gLogger line here or in loop(): usually that is webLog, and every
+    // connect or disconnect would change the "log" feed this stream serves
+}
+
+void DisplayEventStream::loop() {
+    if (clients_.empty()) return;
+    const uint32_t now = millis();
+    if (now - lastRunMs_ < coalesceMs_) return;
+    lastRunMs_ = now;
+
+    for (size_t i = 0; i < clients_.size();) {
+        const bool expired = maxConnectionMs_ && now - clients_[i].connectedMs >= maxConnectionMs_;
+        if (!expired && send_(clients_[i], now)) { ++i; continue; }
+        clients_[i].client.stop();
+        clients_.erase(clients_.begin() + i);
+    }
+}
+
+bool DisplayEventStream::send_(Client_& c, uint32_t now) {
+    if (!c.client.connected()) return false;
+
+    ClientWriter w(c.client);
+    JsonWriter j(w);
+    bool any = false;
+    for (size_t i = 0; i < displays_->size(); ++i) {
+        const WebDisplayBase* d = (*displays_)[i].second;
+        if (d->updateInterval() == 0) continue;   // buttons: the route is an action
+
+        const bool due = c.fresh ||
+            (d->tracksChanges() ? d->version() != c.sentVersion[i]
+                                : now - c.sentMs[i] >= d->updateInterval() * 1000);
+        if (!due) continue;
+
+        if (!any) { w.write(F("data: ")); j.beginObject(); }
+        j.key(d->id());
+        d->writeValue(j);   // JSON, no raw newlines
+        c.sentVersion[i] = d->version();
+        c.sentMs[i]      = now;
+        any = true;
+    }
+    if (any) { j.endObject(); w.write(F("\n\n")); }
+
+    for (size_t f = 0; f < feeds_.size(); ++f) {
+        const Feed_& fd = feeds_[f];
+        const uint32_t v = fd.version ? fd.version() : 0;
+        const bool due = c.fresh ||
+            (now - c.feedMs[f] >= fd.intervalMs && (!fd.version || v != c.feedVersion[f]));
+        if (!due) continue;
+
+        w.write(F("event: "));
+        w.write(fd.name);
+        w.write(F("\ndata: "));
+        {
+            EventDataWriter d(w);
+            if (fd.delta) fd.delta(d, c.fresh ? 0 : c.feedVersion[f]);
+            else          fd.write(d);
+        }
+        w.write(F("\n\n"));
+        c.feedVersion[f] = v;
+        c.feedMs[f]      = now;
+        any = true;
+    }
+    c.fresh = false;
+
+    if (!any) {
+        if (now - c.lastWriteMs < heartbeatMs_) return true;
+        w.write(F(": hb\n\n"));
+    }
+    w.flush();
+    c.lastWriteMs = now;
+    return !w.failed();
+}
@@ -0,0 +1,90 @@
+// -----------------------------------------------------------------------------
+// DisplayEventStream.h  – Server-Sent Events push channel for WebDisplay values
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+#include <WebServer.h>
+#include <WiFi.h>
+#include <vector>
+#include <functional>
+#include "WebDisplay.h"
+
+/**
+ * Keeps one long-lived text/event-stream connection per browser open and
+ * pushes the displays whose value changed since the last event.
+ *
+ *  • one event = {"<id>":<writeJson>, ...}, the same shape as /displays.json
+ *  • changes are gathered for 'coalesceMs' before an event goes out
+ *  • displays without change tracking are re-sent on their updateInterval
+ *  • a comment line every 'heartbeatMs' keeps proxies quiet and detects
+ *    browsers that went away
+ *  • feeds (addFeed) ride along as named events, so e.g. the status panel
+ *    needs no polling connections of its own while the stream is open
+ *  • a connection is closed after 'maxConnectionMs'; the browser reconnects
+ *    after the retry delay and polls in between
+ *
+ * The sync WebServer hands the socket over and returns; loop() (called right
+ * after handleClient()) does the writing on the same task.
+ */
+class DisplayEventStream {
+public:
+    using DisplayList = std::vector<std::pair<String, WebDisplayBase*>>;
+    using FeedWriter  = std::function<void(ChunkedWriter&)>;
+    using FeedVersion = std::function<uint32_t()>;
+    using FeedDelta   = std::function<void(ChunkedWriter&, uint32_t since)>;
+
+    void setCoalesceMs(uint32_t ms)      { coalesceMs_ = ms; }
+    void setHeartbeatMs(uint32_t ms)     { heartbeatMs_ = ms; }
+    void setMaxClients(size_t n)         { maxClients_ = n; }
+    void setMaxConnectionMs(uint32_t ms) { maxConnectionMs_ = ms; }   // 0: unlimited
+
+    /** pushes the output of 'write' as event 'name' (bwiOn(name, fn) on the
+        page) every 'intervalMs' – or, with 'version', when that changes but
+        at most every 'intervalMs'. Multi-line output is fine. */
+    void addFeed(const char* name, uint32_t intervalMs, FeedWriter write,
+                 FeedVersion version = nullptr);
+    /** the same for a feed that can send only what changed: 'write' gets
+        the version this client last got (0 on its first event, so after a
+        reconnect everything goes out again) */
+    void addDeltaFeed(const char* name, uint32_t intervalMs, FeedDelta write,
+                      FeedVersion version);
+
+    /** registers GET /events; 'displays' must not change afterwards */
+    void setupRoutes(WebServer& srv, const DisplayList& displays);
+
+    /** pushes pending changes to all connected browsers */
+    void loop();
+
+    size_t clients() const { return clients_.size(); }
+
+private:
+    struct Client_ {
+        WiFiClient            client;
+        std::vector<uint32_t> sentVersion;   // per display
+        std::vector<uint32_t> sentMs;        // per display (untracked ones)
+        std::vector<uint32_t> feedVersion;   // per feed
+        std::vector<uint32_t> feedMs;        // per feed
+        uint32_t              connectedMs = 0;
+        uint32_t              lastWriteMs = 0;
+        bool                  fresh       = true;   // nothing sent yet
+    };
+    struct Feed_ {
+        const char* name;
+        uint32_t    intervalMs;
+        FeedWriter  write;
+        FeedVersion version;
+        FeedDelta   delta;   // instead of 'write' (addDeltaFeed)
+    };
+
+    void accept_(WebServer& srv);
+    bool send_(Client_& c, uint32_t now);   // false: connection lost
+
+    const DisplayList*   displays_        = nullptr;
+    std::vector<Client_> clients_;
+    std::vector<Feed_>   feeds_;
+    uint32_t             coalesceMs_      = 250;
+    uint32_t             heartbeatMs_     = 15000;
+    uint32_t             maxConnectionMs_ = 10UL * 60 * 1000;
+    size_t               maxClients_      = 4;
+    uint32_t             lastRunMs_       = 0;
+};
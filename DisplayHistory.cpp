@@ -0,0 +1,95 @@
+#include "DisplayHistory.h"
+#include "JsonWriter.h"
+#include <cmath>
+
+void DisplayHistoryBase::add(float v, uint32_t nowMs) {
+    if (std::isnan(v)) return;
+    xSemaphoreTake(mutex_, portMAX_DELAY);
+    for (uint8_t l = 0; l < kLevels; ++l) {
+        Level_& lv = levels_[l];
+        const uint32_t period = periodMs(l);
+        const uint32_t start  = nowMs - nowMs % period;
+        if (!lv.started) {
+            lv.openStartMs = start;
+            lv.started     = true;
+        } else if (start != lv.openStartMs) {
+            push_(l, lv.open);
+            // slots that passed without a sample (at most one full ring)
+            uint32_t gaps = (start - lv.openStartMs) / period - 1;
+            if (gaps > slots_) gaps = slots_;
+            for (uint32_t i = 0; i < gaps; ++i) push_(l, HistoryBucket());
+            lv.open        = HistoryBucket();
+            lv.openStartMs = start;
+        }
+        lv.open.add(v);
+    }
+    xSemaphoreGive(mutex_);
+}
+
+void DisplayHistoryBase::push_(uint8_t level, const HistoryBucket& b) {
+    Level_& lv = levels_[level];
+    rings_[level * slots_ + lv.head] = b;
+    lv.head = (lv.head + 1) % slots_;
+    if (lv.size < slots_) ++lv.size;
+    ++lv.pushes;
+}
+
+bool DisplayHistoryBase::bucket_(uint8_t level, const Level_& at, uint16_t i, HistoryBucket& out) const {
+    xSemaphoreTake(mutex_, portMAX_DELAY);
+    const Level_& lv = levels_[level];
+    // the i-th closed bucket of 'at' is overwritten by push number
+    // slots_ - at.size + i + 1 after it
+    const bool valid = lv.pushes - at.pushes <= (uint32_t)(slots_ - at.size + i);
+    if (valid) out = rings_[level * slots_ + (at.head + slots_ - at.size + i) % slots_];
+    xSemaphoreGive(mutex_);
+    return valid;
+}
+
+void DisplayHistoryBase::writeJson(ChunkedWriter& w, uint8_t level, uint32_t nowMs) const {
+    JsonWriter j(w);
+    writeJson(j, level, nowMs);
+}
+
+void DisplayHistoryBase::writeJson(JsonWriter& j, uint8_t level, uint32_t nowMs) const {
+    if (level >= kLevels) level = kLevels - 1;
+    xSemaphoreTake(mutex_, portMAX_DELAY);
+    const Level_ lv = levels_[level];   // the state this answer describes
+    xSemaphoreGive(mutex_);
+
+    j.beginObject()
+     .member("period", periodMs(level))
+     .member("age", lv.started ? nowMs - lv.openStartMs : 0);
+
+    // one column per statistic; the open bucket (if any) is the last entry
+    static const char* const kColumns[] = { "min", "max", "avg" };
+    const uint16_t n = lv.size + (lv.started ? 1 : 0);
+    for (uint8_t c = 0; c < 3; ++c) {
+        j.key(kColumns[c]).beginArray();
+        for (uint16_t i = 0; i < n; ++i) {
+            HistoryBucket b = lv.open;
+            if (i < lv.size && !bucket_(level, lv, i, b)) b = HistoryBucket();
+            if (!b.count) { j.null(); continue; }
+            j.value(c == 0 ? b.min : c == 1 ? b.max : b.sum / b.count, precision_);
+        }
+        j.endArray();
+    }
+    j.endObject();
+}
+
+uint32_t DisplayHistoryBase::sparkIntervalMs() const {
+    uint32_t iv = periodMs(sparkLevel_);
+    if (iv < 5000) iv = 5000;
+    if (iv > 60000) iv = 60000;
+    return iv;
+}
+
+String DisplayHistoryBase::createSparklineHtml(const String& id) const {
+    String html;
+    html.reserve(id.length() + 100);
+    html += "<canvas class=\"bwi-spark\" width=\"240\" height=\"40\" data-bwi=\"spark\" data-id=\"";
+    html += id;
+    html += "\" data-iv=\"";
+    html += String(sparkIntervalMs());
+    html += "\"></canvas>\n";
+    return html;
+}
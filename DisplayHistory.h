@@ -0,0 +1,119 @@
+// -----------------------------------------------------------------------------
+// DisplayHistory.h  – fixed-size multi-resolution history for a WebDisplay
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+
+class ChunkedWriter;
+class JsonWriter;
+
+// Buckets kept per resolution (1 s, 1 min, 1 h). Memory per history is
+// 3 * DISPLAY_HISTORY_SLOTS * sizeof(HistoryBucket) (16 bytes) plus a few
+// bytes of state; a DisplayHistory<N> can override it per instance.
+#ifndef DISPLAY_HISTORY_SLOTS
+#define DISPLAY_HISTORY_SLOTS 60
+#endif
+
+/** min / max / average of the samples that fell into one time slot */
+struct HistoryBucket {
+    float    min   = 0;
+    float    max   = 0;
+    float    sum   = 0;
+    uint16_t count = 0;   // 0: no sample in this slot
+
+    void add(float v) {
+        if (!count || v < min) min = v;
+        if (!count || v > max) max = v;
+        sum += v;
+        if (count < 0xffff) ++count;
+        else sum -= sum / count;   // saturated: keep the average, drop weight
+    }
+};
+
+/**
+ * Every sample goes into one open bucket per resolution; when its slot is
+ * over the bucket moves into that resolution's ring (slots without samples
+ * become empty buckets, so the index stays proportional to time).
+ *
+ *  • attach with WebDisplay<T>::attachHistory(); update() feeds it
+ *  • BasicWebInterface serves GET /<id>/history[?level=0|1|2] as columnar
+ *    JSON, oldest first and the open bucket last:
+ *      {"period":60000,"age":1234,"min":[..],"max":[..],"avg":[..]}
+ *    (null where a slot has no samples, 'age' = ms into the open slot)
+ *  • a sparkline of 'sparkLevel' is drawn under the display; the page
+ *    fetches all sparklines together ({"<id>":<history>,...} from
+ *    /histories.json, or the "history" event of /events)
+ *
+ * The storage lives in the derived DisplayHistory<Slots>.
+ *
+ * add() runs on the task that updates the display, writeJson() on the web
+ * task. A mutex guards the state, held only for one sample or one bucket
+ * copy, never while JSON goes out; a slot that rolls out of the ring while
+ * its level is being sent is null from that column on (only ever the
+ * oldest slots, and only a client reading all three columns notices).
+ */
+class DisplayHistoryBase {
+public:
+    static const uint8_t kLevels = 3;
+    static uint32_t periodMs(uint8_t level) {
+        static const uint32_t kPeriods[kLevels] = { 1000, 60000, 3600000 };
+        return kPeriods[level < kLevels ? level : kLevels - 1];
+    }
+
+    virtual ~DisplayHistoryBase() { if (mutex_) vSemaphoreDelete(mutex_); }
+
+    /** records one sample (NaN is ignored) */
+    void add(float v, uint32_t nowMs);
+
+    void writeJson(ChunkedWriter& w, uint8_t level, uint32_t nowMs) const;
+    /** the same object as a value of an enclosing JsonWriter document */
+    void writeJson(JsonWriter& j, uint8_t level, uint32_t nowMs) const;
+
+    /** sparkline canvas bound by /static/bwi.js to display 'id' */
+    String createSparklineHtml(const String& id) const;
+    /** how often the sparkline is redrawn: about once per slot, 5..60 s */
+    uint32_t sparkIntervalMs() const;
+
+    uint8_t sparkLevel() const { return sparkLevel_; }
+    uint16_t slots() const { return slots_; }
+
+protected:
+    DisplayHistoryBase(HistoryBucket* storage, uint16_t slots, uint8_t sparkLevel, uint8_t precision)
+        : rings_(storage), slots_(slots),
+          sparkLevel_(sparkLevel < kLevels ? sparkLevel : kLevels - 1), precision_(precision),
+          mutex_(xSemaphoreCreateMutex()) {}
+
+private:
+    struct Level_ {
+        HistoryBucket open;
+        uint32_t      openStartMs = 0;
+        uint16_t      head        = 0;   // next slot to write
+        uint16_t      size        = 0;
+        bool          started     = false;
+        uint32_t      pushes      = 0;   // buckets moved into the ring so far
+    };
+
+    void push_(uint8_t level, const HistoryBucket& b);
+    /* closed bucket i (0 = oldest) of level state 'at'; false if it has
+       been overwritten since */
+    bool bucket_(uint8_t level, const Level_& at, uint16_t i, HistoryBucket& out) const;
+
+    HistoryBucket* rings_;   // kLevels * slots_, level-major
+    uint16_t       slots_;
+    uint8_t        sparkLevel_;
+    uint8_t        precision_;
+    SemaphoreHandle_t mutex_;        // guards levels_ and rings_
+    Level_         levels_[kLevels];
+};
+
+template <uint16_t Slots = DISPLAY_HISTORY_SLOTS>
+class DisplayHistory : public DisplayHistoryBase {
+public:
+    /** @param sparkLevel resolution drawn by the sparkline (0: 1 s, 1: 1 min, 2: 1 h)
+        @param precision  decimals in the JSON export */
+    explicit DisplayHistory(uint8_t sparkLevel = 1, uint8_t precision = 2)
+        : DisplayHistoryBase(storage_, Slots, sparkLevel, precision) {}
+
+private:
+    HistoryBucket storage_[kLevels * Slots];
+};
@@ -0,0 +1,60 @@
+// -----------------------------------------------------------------------------
+// DisplayValueSlot.h  – wait-free value hand-over from a sensor task to the web task
+// -----------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * Triple buffer holding a display value.
+ *
+ * update() typically runs in a sensor task on the other core while the web
+ * task serialises the value, and copying a String (or any multi-word T) while
+ * it is being assigned tears it. Three copies remove the overlap:
+ *
+ *  • store() fills the back copy and swaps it into the middle slot
+ *  • load() swaps the middle copy to the front if it is newer and reads that
+ *  • neither side waits or retries – a slow HTTP send never stalls the sensor
+ *    loop, and a burst of stores only costs the reader the intermediate values
+ *
+ * One writer task and one reader task (the one serving the web interface:
+ * BasicWebInterface::loop() or its startTask() task) per slot; the reference
+ * from load() stays valid until that task calls load() again.
+ */
+template <typename T>
+class DisplayValueSlot {
+public:
+    explicit DisplayValueSlot(const T& initial) : buf_{initial, initial, initial} {}
+
+    /** writer side; false (and nothing published) if v equals the last stored value */
+    bool store(const T& v) {
+        // last_ is the middle or the front copy: only ever read, never written
+        if (buf_[last_] == v) return false;
+        buf_[back_] = v;
+        const uint8_t prev = middle_.exchange(back_ | kFresh, std::memory_order_acq_rel);
+        last_ = back_;
+        back_ = prev & kIndex;
+        return true;
+    }
+
+    /** writer side: the value of the last successful store() */
+    const T& last() const { return buf_[last_]; }
+
+    /** reader side: the newest complete value */
+    const T& load() const {
+        if (middle_.load(std::memory_order_acquire) & kFresh) {
+            front_ = middle_.exchange(front_, std::memory_order_acq_rel) & kIndex;
+        }
+        return buf_[front_];
+    }
+
+private:
+    static const uint8_t kIndex = 0x3;
+    static const uint8_t kFresh = 0x4;   // middle holds a value the reader has not taken
+
+    T                            buf_[3];
+    uint8_t                      back_   = 0;   // writer only
+    uint8_t                      last_   = 1;   // writer only
+    mutable std::atomic<uint8_t> middle_{1};
+    mutable uint8_t              front_  = 2;   // reader only
+};
@@ -0,0 +1,120 @@
+#include "JsonWriter.h"
+
+//----------------------------------------------------------------------------
+// CBOR
+//----------------------------------------------------------------------------
+void Cbor::writeHead(ChunkedWriter& w, uint8_t major, uint32_t arg) {
+    const uint8_t m = major << 5;
+    if (arg < 24) {
+        w.write(char(m | arg));
+    } else if (arg <= 0xff) {
+        w.write(char(m | 24)); w.write(char(arg));
+    } else if (arg <= 0xffff) {
+        w.write(char(m | 25)); w.write(char(arg >> 8)); w.write(char(arg));
+    } else {
+        w.write(char(m | 26));
+        w.write(char(arg >> 24)); w.write(char(arg >> 16)); w.write(char(arg >> 8)); w.write(char(arg));
+    }
+}
+
+void Cbor::writeHead64(ChunkedWriter& w, uint8_t major, uint64_t arg) {
+    if (arg <= 0xffffffffull) { writeHead(w, major, (uint32_t)arg); return; }
+    w.write(char((major << 5) | 27));
+    for (int shift = 56; shift >= 0; shift -= 8) w.write(char(arg >> shift));
+}
+
+void Cbor::writeInt(ChunkedWriter& w, int32_t v) {
+    if (v >= 0) writeHead(w, 0, (uint32_t)v);
+    else        writeHead(w, 1, (uint32_t)(-1 - v));
+}
+
+void Cbor::writeInt64(ChunkedWriter& w, int64_t v) {
+    if (v >= 0) writeHead64(w, 0, (uint64_t)v);
+    else        writeHead64(w, 1, (uint64_t)(-1 - v));
+}
+
+void Cbor::writeFloat(ChunkedWriter& w, float v) {
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    w.write(char(0xfa));
+    w.write(char(bits >> 24)); w.write(char(bits >> 16)); w.write(char(bits >> 8)); w.write(char(bits));
+}
+
+void Cbor::writeDouble(ChunkedWriter& w, double v) {
+    const float f = (float)v;
+    if ((double)f == v || v != v) { writeFloat(w, f); return; }   // exact (or NaN): 4 bytes do
+    uint64_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    w.write(char(0xfb));
+    for (int shift = 56; shift >= 0; shift -= 8) w.write(char(bits >> shift));
+}
+
+void Cbor::writeText(ChunkedWriter& w, const char* s, size_t n) {
+    writeHead(w, 3, (uint32_t)n);
+    w.write(s, n);
+}
+
+//----------------------------------------------------------------------------
+// JsonWriter
+//----------------------------------------------------------------------------
+void JsonWriter::next_() {
+    if (cbor_) return;   // no separators
+    if (afterKey_) { afterKey_ = false; return; }
+    const uint32_t bit = 1u << depth_;
+    if (depth_ && (used_ & bit)) out_.write(',');
+    used_ |= bit;
+}
+
+void JsonWriter::open_(char c) {
+    next_();
+    if (cbor_) out_.write(char(c == '{' ? 0xbf : 0x9f));   // indefinite map / array
+    else       out_.write(c);
+    if (depth_ < 31) ++depth_;
+    used_ &= ~(1u << depth_);
+}
+
+void JsonWriter::close_(char c) {
+    if (cbor_) out_.write(char(0xff));   // "break"
+    else       out_.write(c);
+    if (depth_) --depth_;
+}
+
+JsonWriter& JsonWriter::key(const char* k) {
+    next_();
+    if (cbor_) {
+        Cbor::writeText(out_, k);
+        return *this;
+    }
+    out_.writeJsonString(k);
+    out_.write(':');
+    afterKey_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(float v, unsigned precision) {
+    next_();
+    if (cbor_)                 Cbor::writeFloat(out_, v);
+    else if (std::isfinite(v)) out_.writeFloat(v, precision);
+    else                       out_.write(F("null"));
+    return *this;
+}
+
+JsonWriter& JsonWriter::null() {
+    next_();
+    if (cbor_) Cbor::writeNull(out_);
+    else       out_.write(F("null"));
+    return *this;
+}
+
+JsonWriter& JsonWriter::raw(const char* json) {
+    next_();
+    if (cbor_) Cbor::writeText(out_, json);
+    else       out_.write(json);
+    return *this;
+}
+
+JsonWriter& JsonWriter::encoded(const char* data, size_t n) {
+    next_();
+    out_.write(data, n);
+    return *this;
+}
@@ -0,0 +1,204 @@
+// -----------------------------------------------------------------------------
+// JsonWriter.h  – allocation-free JSON (or CBOR) output on top of ChunkedWriter
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+#include <type_traits>
+#include <cmath>
+#include "ChunkedWriter.h"
+
+/**
+ * JsonTraits<T>::write()  – T as a JSON literal
+ * JsonTraits<T>::writeText() – T as plain page text (strings HTML-escaped)
+ *
+ * Integers, bool, float/double (non-finite -> null), Arduino String and
+ * C strings are covered; specialise it for your own types.
+ */
+template <typename T, typename Enable = void>
+struct JsonTraits;
+
+/* signed integers (except bool); 32-bit formatting unless T is wider */
+template <typename T>
+struct JsonTraits<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value
+                                             && !std::is_same<T, bool>::value>::type> {
+    static void write(ChunkedWriter& w, const T& v) {
+        if (sizeof(T) <= 4) w.writeInt((int32_t)v);
+        else                w.writeInt64((int64_t)v);
+    }
+    static void writeText(ChunkedWriter& w, const T& v) { write(w, v); }
+};
+
+/* unsigned integers (except bool) */
+template <typename T>
+struct JsonTraits<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value
+                                             && !std::is_same<T, bool>::value>::type> {
+    static void write(ChunkedWriter& w, const T& v) {
+        if (sizeof(T) <= 4) w.writeUInt((uint32_t)v);
+        else                w.writeUInt64((uint64_t)v);
+    }
+    static void writeText(ChunkedWriter& w, const T& v) { write(w, v); }
+};
+
+/* bool */
+template <typename T>
+struct JsonTraits<T, typename std::enable_if<std::is_same<T, bool>::value>::type> {
+    static void write(ChunkedWriter& w, const T& v)     { w.writeBool(v); }
+    static void writeText(ChunkedWriter& w, const T& v) { w.writeBool(v); }
+};
+
+/* float / double: two decimals, like String(float) / String(double) */
+template <typename T>
+struct JsonTraits<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    static const unsigned kPrecision = 2;
+    static void write(ChunkedWriter& w, const T& v) {
+        if (std::isfinite(v)) writeText(w, v);
+        else             w.write(F("null"));
+    }
+    static void writeText(ChunkedWriter& w, const T& v) {
+        if (sizeof(T) <= sizeof(float)) w.writeFloat((float)v, kPrecision);
+        else                            w.writeDouble((double)v, kPrecision);
+    }
+};
+
+/* Arduino String */
+template <typename T>
+struct JsonTraits<T, typename std::enable_if<std::is_same<T, String>::value>::type> {
+    static void write(ChunkedWriter& w, const T& v)     { w.writeJsonString(v); }
+    static void writeText(ChunkedWriter& w, const T& v) { w.writeHtmlEscaped(v); }
+};
+
+/* C strings and string literals */
+template <>
+struct JsonTraits<const char*> {
+    static void write(ChunkedWriter& w, const char* v)     { w.writeJsonString(v); }
+    static void writeText(ChunkedWriter& w, const char* v) { w.writeHtmlEscaped(v); }
+};
+template <size_t N>
+struct JsonTraits<char[N]> : JsonTraits<const char*> {};
+
+// -----------------------------------------------------------------------------
+//  CBOR (RFC 8949) building blocks and CborTraits<T>, the binary twin of
+//  JsonTraits<T>: integers in their shortest form, floats as float32 (a
+//  double as well if that is exact, else float64)
+// -----------------------------------------------------------------------------
+namespace Cbor {
+    /** major type (0..7) + argument in the shortest encoding */
+    void writeHead(ChunkedWriter& w, uint8_t major, uint32_t arg);
+    /** the same with an 8-byte argument where it needs one */
+    void writeHead64(ChunkedWriter& w, uint8_t major, uint64_t arg);
+    void writeInt(ChunkedWriter& w, int32_t v);
+    void writeInt64(ChunkedWriter& w, int64_t v);
+    void writeFloat(ChunkedWriter& w, float v);
+    void writeDouble(ChunkedWriter& w, double v);
+    void writeText(ChunkedWriter& w, const char* s, size_t n);
+    inline void writeText(ChunkedWriter& w, const char* s) { writeText(w, s, s ? strlen(s) : 0); }
+    inline void writeBool(ChunkedWriter& w, bool v) { w.write(char(v ? 0xf5 : 0xf4)); }
+    inline void writeNull(ChunkedWriter& w)         { w.write(char(0xf6)); }
+}
+
+template <typename T, typename Enable = void>
+struct CborTraits;
+
+template <typename T>
+struct CborTraits<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value
+                                             && !std::is_same<T, bool>::value>::type> {
+    static void write(ChunkedWriter& w, const T& v) {
+        if (sizeof(T) <= 4) Cbor::writeInt(w, (int32_t)v);
+        else                Cbor::writeInt64(w, (int64_t)v);
+    }
+};
+template <typename T>
+struct CborTraits<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value
+                                             && !std::is_same<T, bool>::value>::type> {
+    static void write(ChunkedWriter& w, const T& v) {
+        if (sizeof(T) <= 4) Cbor::writeHead(w, 0, (uint32_t)v);
+        else                Cbor::writeHead64(w, 0, (uint64_t)v);
+    }
+};
+template <typename T>
+struct CborTraits<T, typename std::enable_if<std::is_same<T, bool>::value>::type> {
+    static void write(ChunkedWriter& w, const T& v) { Cbor::writeBool(w, v); }
+};
+template <typename T>
+struct CborTraits<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+    static void write(ChunkedWriter& w, const T& v) {
+        if (sizeof(T) <= sizeof(float)) Cbor::writeFloat(w, (float)v);
+        else                            Cbor::writeDouble(w, (double)v);
+    }
+};
+template <typename T>
+struct CborTraits<T, typename std::enable_if<std::is_same<T, String>::value>::type> {
+    static void write(ChunkedWriter& w, const T& v) { Cbor::writeText(w, v.c_str(), v.length()); }
+};
+template <>
+struct CborTraits<const char*> {
+    static void write(ChunkedWriter& w, const char* v) { Cbor::writeText(w, v); }
+};
+template <size_t N>
+struct CborTraits<char[N]> : CborTraits<const char*> {};
+
+/**
+ * Writes objects and arrays with the commas in the right places:
+ *
+ *   JsonWriter j(w);
+ *   j.beginObject().member("id", id()).member("value", 1.5f).endObject();
+ *
+ * Nothing is buffered here – output goes straight into the ChunkedWriter, so
+ * the sink decides where it ends up (socket, fixed buffer, String).
+ * Nesting is limited to 31 levels.
+ *
+ * Constructed with Format::Cbor the same calls produce CBOR instead
+ * (indefinite-length maps/arrays, values through CborTraits<T>), so one
+ * serialisation routine serves both wire formats.
+ */
+class JsonWriter {
+public:
+    enum class Format : uint8_t { Json, Cbor };
+
+    explicit JsonWriter(ChunkedWriter& out, Format format = Format::Json)
+        : out_(out), cbor_(format == Format::Cbor) {}
+
+    bool cbor() const { return cbor_; }
+
+    JsonWriter& beginObject() { open_('{'); return *this; }
+    JsonWriter& endObject()   { close_('}'); return *this; }
+    JsonWriter& beginArray()  { open_('['); return *this; }
+    JsonWriter& endArray()    { close_(']'); return *this; }
+
+    /** member name inside an object; the next value belongs to it */
+    JsonWriter& key(const char* k);
+    JsonWriter& key(const String& k) { return key(k.c_str()); }
+
+    template <typename T>
+    JsonWriter& value(const T& v) {
+        next_();
+        if (cbor_) CborTraits<T>::write(out_, v);
+        else       JsonTraits<T>::write(out_, v);
+        return *this;
+    }
+    /** float with explicit decimals (non-finite -> null; CBOR: full float32) */
+    JsonWriter& value(float v, unsigned precision);
+    JsonWriter& null();
+    /** already serialised JSON (e.g. from a routeText() override); in CBOR
+        mode it is embedded as a text string */
+    JsonWriter& raw(const char* json);
+    /** one value already encoded in this writer's format (by another
+        JsonWriter with the same Format), copied through as is */
+    JsonWriter& encoded(const char* data, size_t n);
+
+    template <typename T>
+    JsonWriter& member(const char* k, const T& v) { key(k); return value(v); }
+
+    ChunkedWriter& out() { return out_; }
+
+private:
+    void next_();
+    void open_(char c);
+    void close_(char c);
+
+    ChunkedWriter& out_;
+    uint32_t       used_     = 0;   // bit n: container at depth n has an element
+    uint8_t        depth_    = 0;
+    bool           afterKey_ = false;
+    bool           cbor_;
+};
@@ -0,0 +1,116 @@
+#include "NumberFormat.h"
+
+namespace {
+  const uint64_t kPow10[NumberFormat::kMaxFastPrecision + 1] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+    100000000ull, 1000000000ull, 10000000000ull, 100000000000ull
+  };
+
+  // digits of v, right-aligned so that they end at 'end'; returns the first
+  char* writeDigits_(char* end, uint64_t v) {
+    // 32-bit divisions where possible – 64-bit ones are library calls on the ESP32
+    while (v > 0xffffffffull) { *--end = char('0' + v % 10); v /= 10; }
+    uint32_t s = (uint32_t)v;
+    do { *--end = char('0' + s % 10); s /= 10; } while (s);
+    return end;
+  }
+
+  size_t fallback_(char* buf, float v, unsigned precision) {
+    int n = snprintf(buf, NumberFormat::kBufSize, "%.*f", (int)precision, (double)v);
+    if (n < 0) { buf[0] = 0; return 0; }
+    if ((size_t)n >= NumberFormat::kBufSize) n = NumberFormat::kBufSize - 1;
+    return (size_t)n;
+  }
+}
+
+size_t NumberFormat::formatUInt(char* buf, uint32_t v) {
+    return formatUInt64(buf, v);
+}
+
+size_t NumberFormat::formatInt(char* buf, int32_t v) {
+    return formatInt64(buf, v);
+}
+
+size_t NumberFormat::formatUInt64(char* buf, uint64_t v) {
+    char tmp[20];
+    char* first = writeDigits_(tmp + sizeof(tmp), v);
+    const size_t n = tmp + sizeof(tmp) - first;
+    memcpy(buf, first, n);
+    buf[n] = 0;
+    return n;
+}
+
+size_t NumberFormat::formatInt64(char* buf, int64_t v) {
+    if (v >= 0) return formatUInt64(buf, (uint64_t)v);
+    buf[0] = '-';
+    return 1 + formatUInt64(buf + 1, 0ull - (uint64_t)v);
+}
+
+size_t NumberFormat::formatFloat(char* buf, float v, unsigned precision) {
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    const bool     neg  = bits >> 31;
+    const uint32_t exp8 = (bits >> 23) & 0xff;
+    const uint32_t frac = bits & 0x7fffff;
+
+    if (exp8 == 0xff || precision > kMaxFastPrecision) return fallback_(buf, v, precision);  // nan, inf
+
+    // v = m * 2^e exactly; q = round(v * 10^precision) in integers
+    const uint64_t m = exp8 ? (frac | 0x800000u) : frac;
+    const int      e = exp8 ? (int)exp8 - 150 : -149;
+    const uint64_t n = m * kPow10[precision];
+    uint64_t q;
+    if (e >= 0) {
+        if (e >= 63 || n > ((~0ull >> 1) >> e)) return fallback_(buf, v, precision);
+        q = n << e;
+    } else if (-e >= 64) {
+        q = 0;                                   // below half a unit
+    } else {
+        const int      s    = -e;
+        const uint64_t rem  = n & ((1ull << s) - 1);
+        const uint64_t half = 1ull << (s - 1);
+        q = n >> s;
+        if (rem > half || (rem == half && (q & 1))) ++q;
+    }
+
+    // digits back to front: fraction (zero-padded), point, integer part
+    char tmp[kBufSize];
+    char* end = tmp + sizeof(tmp);
+    char* p   = end;
+    if (precision) {
+        const uint64_t scale = kPow10[precision];
+        char* fracEnd = p;
+        p = writeDigits_(p, q % scale);
+        while ((size_t)(fracEnd - p) < precision) *--p = '0';
+        *--p = '.';
+        q /= scale;
+    }
+    p = writeDigits_(p, q);
+    if (neg) *--p = '-';   // like printf, -0.001 at two decimals is "-0.00"
+
+    const size_t len = end - p;
+    memcpy(buf, p, len);
+    buf[len] = 0;
+    return len;
+}
+
+size_t NumberFormat::formatDouble(char* buf, double v, unsigned precision) {
+    const float f = (float)v;
+    if ((double)f == v) return formatFloat(buf, f, precision);
+    int n = snprintf(buf, kBufSize, "%.*f", (int)precision, v);
+    if (n >= (int)kBufSize) n = snprintf(buf, kBufSize, "%.17g", v);
+    if (n < 0) { buf[0] = 0; return 0; }
+    return (size_t)n;
+}
+
+String NumberFormat::toString(float v, unsigned precision) {
+    char buf[kBufSize];
+    formatFloat(buf, v, precision);
+    return String(buf);
+}
+
+String NumberFormat::toString(int32_t v) {
+    char buf[kBufSize];
+    formatInt(buf, v);
+    return String(buf);
+}
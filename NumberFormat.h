@@ -0,0 +1,35 @@
+// -----------------------------------------------------------------------------
+// NumberFormat.h  – allocation-free integer / fixed-point formatting
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+
+/**
+ * Writes numbers into a caller-supplied stack buffer, NUL-terminated, and
+ * returns the length. formatFloat() gives exactly what "%.*f" gives (the
+ * float's binary value rounded half-to-even), so a value printed with the
+ * precision from setPrecisionFromStep() reads back to the same step; it
+ * works on the float bits in 64-bit integers instead of going through
+ * printf/dtostrf. Magnitudes beyond 2^63 / 10^precision and precisions above
+ * kMaxFastPrecision fall back to snprintf.
+ *
+ *   char buf[NumberFormat::kBufSize];
+ *   NumberFormat::formatFloat(buf, 21.5f, 1);   // "21.5"
+ */
+namespace NumberFormat {
+  static const size_t   kBufSize          = 56;   // any int; any float at up to 11 decimals
+  static const unsigned kMaxFastPrecision = 11;   // 2^24 * 10^11 < 2^63
+
+  size_t formatUInt(char* buf, uint32_t v);
+  size_t formatInt(char* buf, int32_t v);
+  size_t formatUInt64(char* buf, uint64_t v);
+  size_t formatInt64(char* buf, int64_t v);
+  size_t formatFloat(char* buf, float v, unsigned precision);
+  /** "%.*f" of the double; a value that is exactly a float takes the fast
+      path, one too long for kBufSize comes out as "%.17g" */
+  size_t formatDouble(char* buf, double v, unsigned precision);
+
+  /** String wrappers for the String-returning APIs (one allocation) */
+  String toString(float v, unsigned precision);
+  String toString(int32_t v);
+}
@@ -0,0 +1,62 @@
+#include "RouteTable.h"
+
+uint32_t RouteTable::hash(const char* s, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; ++i) { h ^= (uint8_t)s[i]; h *= 16777619u; }
+    return h;
+}
+
+void RouteTable::add(const String& path, HTTPMethod method, uint8_t kind, void* target) {
+    if ((count_ + 1) * 2 > slots_.size()) grow_();
+    const uint32_t h    = hash(path.c_str(), path.length());
+    const size_t   mask = slots_.size() - 1;
+    for (size_t i = h & mask;; i = (i + 1) & mask) {
+        Route& r = slots_[i];
+        const bool empty = r.path.length() == 0;
+        if (empty || (r.hash == h && r.method == method && r.path == path)) {
+            if (empty) ++count_;
+            r.path   = path;
+            r.hash   = h;
+            r.method = method;
+            r.kind   = kind;
+            r.target = target;
+            return;
+        }
+    }
+}
+
+const RouteTable::Route* RouteTable::find(HTTPMethod method, const char* path, size_t len) const {
+    if (!count_) return nullptr;
+    const uint32_t h    = hash(path, len);
+    const size_t   mask = slots_.size() - 1;
+    for (size_t i = h & mask;; i = (i + 1) & mask) {
+        const Route& r = slots_[i];
+        if (r.path.length() == 0) return nullptr;
+        if (r.hash == h && r.method == method && r.path.length() == len
+            && memcmp(r.path.c_str(), path, len) == 0) return &r;
+    }
+}
+
+void RouteTable::grow_() {
+    std::vector<Route> old;
+    old.swap(slots_);
+    slots_.resize(old.empty() ? 16 : old.size() * 2);
+    count_ = 0;
+    for (auto& r : old) {
+        if (r.path.length()) add(r.path, r.method, r.kind, r.target);
+    }
+}
+
+bool RouteTable::canHandle(HTTPMethod method, RouteUri uri) {
+    match_ = find(method, uri);
+    return match_ != nullptr;
+}
+
+bool RouteTable::handle(WebServer&, HTTPMethod method, RouteUri uri) {
+    // WebServer calls canHandle() right before; look up again only if it did not
+    const Route* r = match_ ? match_ : find(method, uri);
+    match_ = nullptr;
+    if (!r) return false;
+    dispatch_(*r);
+    return true;
+}
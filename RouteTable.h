@@ -0,0 +1,65 @@
+// -----------------------------------------------------------------------------
+// RouteTable.h  – one WebServer handler dispatching many fixed paths by hash
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+#include <WebServer.h>
+#include <functional>
+#include <vector>
+
+// RequestHandler takes the URI by value up to core 2.x, by reference since 3.0
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 3
+typedef const String& RouteUri;
+#else
+typedef String RouteUri;
+#endif
+
+/**
+ * WebServer matches a request by walking its handler list and comparing the
+ * URI against every server.on() path in turn, and each of those handlers
+ * holds its own std::function. A RouteTable is a single handler for any
+ * number of exact paths:
+ *
+ *  • routes are (path, method) -> (kind, target) entries in an open-
+ *    addressing table keyed by FNV-1a of the path; a lookup is one hash of
+ *    the URI plus (almost always) one string compare
+ *  • one Dispatch callback for the whole table switches on 'kind'
+ *
+ * Add it to the server before the other handlers so that its paths are
+ * found first; paths it does not know fall through to the rest of the list.
+ */
+class RouteTable : public RequestHandler {
+public:
+    struct Route {
+        String     path;
+        uint32_t   hash   = 0;
+        HTTPMethod method = HTTP_GET;
+        uint8_t    kind   = 0;
+        void*      target = nullptr;
+    };
+    typedef std::function<void(const Route&)> Dispatch;
+
+    explicit RouteTable(Dispatch dispatch) : dispatch_(std::move(dispatch)) {}
+
+    /** a later add() with the same path and method replaces the earlier one */
+    void add(const String& path, HTTPMethod method, uint8_t kind, void* target = nullptr);
+    const Route* find(HTTPMethod method, const char* path, size_t len) const;
+    const Route* find(HTTPMethod method, const String& path) const {
+        return find(method, path.c_str(), path.length());
+    }
+    size_t size() const { return count_; }
+
+    static uint32_t hash(const char* s, size_t len);
+
+    // ------------------------------------------------------ RequestHandler ----
+    bool canHandle(HTTPMethod method, RouteUri uri) override;
+    bool handle(WebServer& server, HTTPMethod method, RouteUri uri) override;
+
+private:
+    void grow_();
+
+    std::vector<Route> slots_;          // power of two, at most half full
+    size_t             count_ = 0;
+    const Route*       match_ = nullptr; // canHandle() -> handle() of the same request
+    Dispatch           dispatch_;
+};
@@ -0,0 +1,81 @@
+#include "SettingsSaveQueue.h"
+#include "WebSettings.h"
+#include <algorithm>
+
+SettingsSaveQueue& SettingsSaveQueue::instance(){ static SettingsSaveQueue inst; return inst; }
+
+SettingsSaveQueue::SettingsSaveQueue() {
+    listMutex_ = xSemaphoreCreateMutex();
+    saveMutex_ = xSemaphoreCreateMutex();
+    if (!listMutex_ || !saveMutex_) {
+        gLogger->println("SettingsSaveQueue: Failed to create mutex");
+    }
+}
+
+bool SettingsSaveQueue::begin(uint32_t coalesceMs, uint32_t stackSize,
+                              UBaseType_t priority, BaseType_t core) {
+    if (task_) return true;
+    if (!listMutex_ || !saveMutex_) return false;
+    coalesceMs_ = coalesceMs;
+    if (xTaskCreatePinnedToCore(taskMain_, "settingsSave", stackSize, this,
+                                priority, &task_, core) != pdPASS) {
+        task_ = nullptr;
+        gLogger->println("SettingsSaveQueue: Failed to start task");
+        return false;
+    }
+    return true;
+}
+
+void SettingsSaveQueue::request(SettingsBlockBase* block) {
+    if (!task_) {   // not started: behave like before
+        block->save();
+        return;
+    }
+    xSemaphoreTake(listMutex_, portMAX_DELAY);
+    if (std::find(pending_.begin(), pending_.end(), block) == pending_.end()) {
+        pending_.push_back(block);
+    }
+    xSemaphoreGive(listMutex_);
+    xTaskNotifyGive(task_);
+}
+
+bool SettingsSaveQueue::pending() {
+    if (!listMutex_) return false;
+    xSemaphoreTake(listMutex_, portMAX_DELAY);
+    const bool any = !pending_.empty();
+    xSemaphoreGive(listMutex_);
+    return any;
+}
+
+void SettingsSaveQueue::flush() {
+    if (!saveMutex_) return;
+    savePending_();
+}
+
+void SettingsSaveQueue::savePending_() {
+    xSemaphoreTake(saveMutex_, portMAX_DELAY);
+
+    std::vector<SettingsBlockBase*> todo;
+    xSemaphoreTake(listMutex_, portMAX_DELAY);
+    todo.swap(pending_);
+    xSemaphoreGive(listMutex_);
+
+    for (auto* block : todo) {
+        block->save();
+        gLogger->println("Settings: " + String(block->url()) + " saved (" +
+                         String((unsigned)block->lastSaveWrites()) + " written, " +
+                         String((unsigned)block->lastSaveSkipped()) + " unchanged)");
+    }
+    xSemaphoreGive(saveMutex_);
+}
+
+void SettingsSaveQueue::taskMain_(void* arg) {
+    auto* self = static_cast<SettingsSaveQueue*>(arg);
+    const TickType_t window = pdMS_TO_TICKS(self->coalesceMs_);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        // merge follow-up requests; a steady stream is still saved after 4 windows
+        for (int i = 0; i < 4 && ulTaskNotifyTake(pdTRUE, window) > 0; ++i) {}
+        self->savePending_();
+    }
+}
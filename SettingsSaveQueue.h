@@ -0,0 +1,49 @@
+// SettingsSaveQueue.h – write-behind persistence for SettingsBlockBase
+#pragma once
+#include <Arduino.h>
+#include <vector>
+
+class SettingsBlockBase;
+
+/**
+ * Background task that performs NVS saves outside the HTTP handler.
+ *
+ *  • blocks opt in with SettingsBlockBase::setDeferredSave(true)
+ *  • requests arriving within 'coalesceMs' of each other are merged, so a
+ *    burst of POSTs costs one save per block
+ *  • call flush() before a reboot or OTA so nothing pending is lost
+ *
+ * Without begin() requests fall back to a synchronous save.
+ */
+class SettingsSaveQueue {
+public:
+    static SettingsSaveQueue& instance();   // singleton
+
+    bool begin(uint32_t coalesceMs = 500,
+               uint32_t stackSize = 4096,
+               UBaseType_t priority = 1,
+               BaseType_t core = tskNO_AFFINITY);
+
+    /** queue a save of 'block' (returns immediately) */
+    void request(SettingsBlockBase* block);
+
+    /** save everything pending now, on the calling task; waits for a save in progress */
+    void flush();
+
+    bool pending();
+    bool running() const { return task_ != nullptr; }
+
+private:
+    SettingsSaveQueue();
+    SettingsSaveQueue(const SettingsSaveQueue&) = delete;
+    SettingsSaveQueue& operator=(const SettingsSaveQueue&) = delete;
+
+    static void taskMain_(void* arg);
+    void savePending_();
+
+    TaskHandle_t                    task_       = nullptr;
+    uint32_t                        coalesceMs_ = 500;
+    SemaphoreHandle_t               listMutex_  = nullptr;  // guards pending_
+    SemaphoreHandle_t               saveMutex_  = nullptr;  // held while saving
+    std::vector<SettingsBlockBase*> pending_;
+};
@@ -0,0 +1,95 @@
+// SettingsSnapshot.h – consistent read-only copies of a settings block for other tasks
+#pragma once
+#include <Arduino.h>
+#include <atomic>
+#include <functional>
+#include "WebSettings.h"
+
+/**
+ * Double-buffered copy of (part of) a settings block.
+ *
+ * Setting<T>::value is written by the web task while a POST is applied, so a
+ * control task on the other core can see half of a String, IPAddress or array.
+ * A snapshot copies the values it needs into a plain struct whenever the block
+ * publishes (after load() and after every POST + sanityCheck(), under the
+ * block lock) and readers only ever look at a complete copy:
+ *
+ *     struct PumpView { float flow; int32_t cycles; IPAddress target; };
+ *     SettingsSnapshot<PumpView> pumpView(pump, [](PumpView& v) {
+ *         v.flow   = pump.flow;
+ *         v.cycles = pump.cycles;
+ *         v.target = pump.target;
+ *     });
+ *     ...
+ *     auto v = pumpView.read();          // never blocks
+ *     drive(v->flow, v->cycles);
+ *
+ *  • readers never take a lock; they retry only if a publish flips the
+ *    buffers in the instant between two of their atomic operations
+ *  • the publisher waits until no reader still holds the buffer it is about
+ *    to overwrite, so keep views short-lived (don't hold one across delays)
+ *  • values changed directly in firmware are picked up by block.publish()
+ */
+template<class Values>
+class SettingsSnapshot : public SettingsSnapshotBase {
+public:
+    using CaptureFn = std::function<void(Values& out)>;
+
+    /* attaches to 'block' and publishes the current values right away */
+    SettingsSnapshot(SettingsBlockBase& block, CaptureFn capture)
+      : capture_(std::move(capture))
+    {
+        block.attachSnapshot(this);
+    }
+
+    /* read-only handle on the buffer that was current when read() was called */
+    class View {
+    public:
+        View(View&& o) : owner_(o.owner_), idx_(o.idx_) { o.owner_ = nullptr; }
+        ~View() { if (owner_) owner_->readers_[idx_].fetch_sub(1); }
+
+        const Values& operator*()  const { return owner_->buf_[idx_]; }
+        const Values* operator->() const { return &owner_->buf_[idx_]; }
+
+    private:
+        friend class SettingsSnapshot;
+        View(const SettingsSnapshot* o, uint8_t i) : owner_(o), idx_(i) {}
+        View(const View&) = delete;
+        View& operator=(const View&) = delete;
+
+        const SettingsSnapshot* owner_;
+        uint8_t                 idx_;
+    };
+
+    View read() const {
+        for (;;) {
+            const uint8_t i = active_.load();
+            readers_[i].fetch_add(1);
+            if (active_.load() == i) return View(this, i);
+            readers_[i].fetch_sub(1);   // flipped meanwhile, take the new one
+        }
+    }
+
+    /* copy of the current values */
+    Values get() const { View v = read(); return *v; }
+
+    /* incremented on every publish */
+    uint32_t version() const { return version_.load(); }
+
+protected:
+    /* called by the block with its lock held; only one publisher at a time */
+    void publish_() override {
+        const uint8_t next = active_.load() ^ 1;
+        while (readers_[next].load() != 0) vTaskDelay(1);   // readers of the previous publish
+        capture_(buf_[next]);
+        active_.store(next);
+        version_.fetch_add(1);
+    }
+
+private:
+    CaptureFn                     capture_;
+    Values                        buf_[2]{};
+    std::atomic<uint8_t>          active_{0};
+    mutable std::atomic<uint32_t> readers_[2] = {{0}, {0}};
+    std::atomic<uint32_t>         version_{0};
+};
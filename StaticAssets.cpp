@@ -0,0 +1,28 @@
+#include "StaticAssets.h"
+#include "ChunkedWriter.h"
+#include <WebServer.h>
+
+void StaticAssets::send(WebServer& srv, const Asset& a, bool immutable) {
+    srv.sendHeader("ETag", a.etag);
+    srv.sendHeader("Cache-Control", immutable ? "public, max-age=31536000, immutable" : "no-cache");
+    // If-None-Match may list several tags
+    if (srv.header("If-None-Match").indexOf(a.etag) >= 0) {
+        srv.send(304);
+        return;
+    }
+    srv.sendHeader("Content-Encoding", "gzip");
+    srv.send_P(200, a.contentType, reinterpret_cast<const char*>(a.gz), a.gzLen);
+}
+
+void StaticAssets::setupRoutes(WebServer& srv) {
+    for (size_t i = 0; i < kRoutedCount; ++i) {
+        const Asset* a = kRouted[i];
+        srv.on(a->url, HTTP_GET, [&srv, a]() { send(srv, *a, true); });
+    }
+}
+
+void StaticAssets::writeVersionedUrl(ChunkedWriter& w, const Asset& a) {
+    w.write(a.url);
+    w.write(F("?v="));
+    w.write(a.version);
+}
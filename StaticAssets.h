@@ -0,0 +1,42 @@
+// -----------------------------------------------------------------------------
+// StaticAssets.h  – pre-gzipped pages, scripts and stylesheets in flash
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+
+class WebServer;
+class ChunkedWriter;
+
+/**
+ * The sources live in assets/; tools/embed_assets.py compresses them into
+ * StaticAssetsData.cpp together with a content hash. Responses carry
+ * Content-Encoding: gzip and the hash as a strong ETag, so a revalidation
+ * costs a 304 without body.
+ *
+ *  • versioned URLs (url?v=<hash>, see writeVersionedUrl) are cached for a
+ *    year as immutable – a firmware with new content changes the URL
+ *  • plain URLs (login / OTA page) are revalidated on every load
+ *
+ * There is no uncompressed fallback; every browser sends Accept-Encoding: gzip.
+ */
+namespace StaticAssets {
+  struct Asset {
+    const char*    url;           // route under /static/, or nullptr
+    const char*    contentType;
+    const uint8_t* gz;
+    size_t         gzLen;
+    const char*    etag;          // "\"<hash>\""
+    const char*    version;       // "<hash>"
+  };
+
+  /** answers the current request with 'a' (or 304 if the client has it) */
+  void send(WebServer& srv, const Asset& a, bool immutable);
+
+  /** GET routes for every asset with a url; served as immutable */
+  void setupRoutes(WebServer& srv);
+
+  /** "<url>?v=<hash>" */
+  void writeVersionedUrl(ChunkedWriter& w, const Asset& a);
+}
+
+#include "StaticAssetsData.h"
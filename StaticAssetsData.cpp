@@ -0,0 +1,372 @@
+// generated by tools/embed_assets.py from assets/ - do not edit
+#include "StaticAssets.h"
+
+// assets/bwi.js: 4891 -> 1887 bytes
+static const uint8_t k_bwiJs[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x58,0x6d,0x6f,0xdb,0x36,
+    0x10,0xfe,0xde,0x5f,0xc1,0x76,0xd8,0x24,0xd5,0xb2,0x62,0xa7,0x69,0xd3,0xc5,0x65,
+    0x8a,0x6d,0xdd,0xd0,0x0d,0xed,0x3a,0x2c,0x03,0x3a,0x20,0xc8,0x07,0x46,0xa2,0x2d,
+    0x2e,0x14,0xe9,0x92,0xb4,0x63,0x23,0xf3,0x7f,0xdf,0x1d,0xf5,0x46,0xd9,0xde,0x5a,
+    0xec,0x43,0x62,0x89,0x3c,0x1e,0xef,0x9e,0x7b,0xee,0x78,0x54,0x3c,0x5f,0xa9,0xdc,
+    0x09,0xad,0xe2,0xe4,0xe1,0x11,0x21,0xb9,0x56,0xd6,0x11,0xbb,0xba,0xb5,0xf4,0x61,
+    0x37,0x23,0x92,0x3b,0x52,0x59,0x3a,0x49,0x89,0x13,0x15,0x37,0x54,0xad,0xa4,0x4c,
+    0x89,0x14,0x6b,0x4e,0xe7,0x4c,0x5a,0x9e,0x12,0xcb,0x3f,0x35,0xa3,0xdc,0xfa,0x87,
+    0x59,0xaf,0xc5,0x72,0x5a,0xe8,0x7c,0x55,0x71,0xe5,0xb2,0x7c,0x65,0x0c,0xfc,0x5e,
+    0xe5,0x46,0x2c,0x1d,0xf9,0xe6,0x1b,0x72,0x7c,0x26,0x2b,0x98,0x63,0x96,0xbb,0x0c,
+    0x16,0xa3,0xa6,0xd6,0x3a,0x52,0x08,0xbb,0x64,0x2e,0x2f,0x63,0x26,0x65,0xf2,0x40,
+    0xe6,0xda,0xc4,0xf5,0x2e,0xa2,0x20,0x42,0x91,0x7a,0x54,0xcc,0x63,0x34,0xfd,0x5a,
+    0x14,0x37,0x09,0x69,0x9f,0x70,0x85,0x1f,0x99,0x91,0x1d,0xd9,0x81,0x4e,0x66,0xb7,
+    0x2a,0xef,0x35,0x3b,0x91,0xdf,0xd5,0xce,0x13,0x54,0x80,0xce,0x25,0xc4,0x70,0xb7,
+    0x32,0x6a,0xe6,0x07,0x9d,0xd9,0xd6,0xb3,0xad,0x63,0x86,0xb2,0x7b,0x26,0x1c,0x99,
+    0x73,0x34,0x28,0x3a,0x41,0xdb,0x24,0xdb,0xda,0xec,0x2f,0xab,0x55,0x34,0x8a,0x01,
+    0x93,0xd7,0xd1,0x6b,0x2b,0x54,0xce,0x69,0x34,0x82,0xb7,0x8b,0x28,0x4a,0x92,0x59,
+    0xa3,0x03,0xf6,0x78,0x6c,0x32,0x7d,0x37,0xdc,0x84,0x04,0x1e,0x7a,0xe5,0xc6,0x6b,
+    0x8b,0xfb,0x75,0x88,0xb4,0xc9,0x4a,0xce,0x0a,0x6e,0x6c,0xb6,0xe0,0x2e,0x8e,0xfe,
+    0x1c,0xbf,0xa9,0xb7,0x1e,0x5f,0xf1,0x4f,0x51,0x23,0xb9,0xcb,0xbd,0x16,0x9e,0x3c,
+    0xa0,0xb3,0xf8,0x87,0xb0,0x58,0x8e,0xa0,0xdf,0x0b,0x55,0xe8,0xfb,0xec,0xc7,0x35,
+    0x02,0xae,0x57,0x26,0xe7,0x8d,0xe3,0x18,0x3c,0x7e,0x4f,0x82,0x09,0xf0,0x8b,0xe3,
+    0x9b,0x6d,0xf5,0x72,0x9b,0x69,0xa5,0x97,0x5c,0xd1,0x38,0xa1,0x97,0x0f,0x35,0x0b,
+    0x9c,0x59,0x71,0xc0,0x35,0x90,0xe0,0xc6,0x68,0x13,0x8a,0x78,0xa2,0x0c,0x65,0x2a,
+    0x6e,0x2d,0x5b,0x70,0x0a,0x46,0xa2,0x18,0x02,0xdc,0xbb,0xff,0xcb,0xd5,0x87,0x5f,
+    0xb3,0x25,0x33,0x96,0xc7,0xdc,0xd3,0x21,0xc1,0xc8,0xd5,0x4e,0x6d,0xc0,0xa9,0x5a,
+    0x13,0xfa,0x75,0x72,0x42,0x60,0x8d,0xb9,0x93,0x42,0x71,0x7b,0x81,0x1c,0x20,0x7a,
+    0x4e,0x5c,0xc9,0x2b,0x32,0x37,0xba,0x22,0x60,0x0c,0x39,0x29,0x85,0x75,0xda,0x08,
+    0x5e,0x47,0x27,0x25,0xda,0xa0,0x04,0x79,0x52,0x8f,0x6f,0x9f,0x10,0xef,0x65,0x4f,
+    0x5a,0x54,0xd8,0x93,0xdf,0xbf,0xbe,0xf7,0x19,0xe0,0x1f,0xff,0xe8,0xd2,0x60,0xc8,
+    0x4e,0xc3,0xee,0xaf,0xfc,0xca,0xcf,0xf2,0xd3,0x4b,0x35,0x0c,0xed,0x9e,0x3f,0xc7,
+    0xd1,0x66,0x6f,0x20,0xea,0x5c,0x18,0xeb,0x86,0x6c,0xc5,0xc0,0x3e,0xae,0xc7,0x0f,
+    0x78,0xfb,0x2f,0x8c,0x1d,0x82,0x02,0x11,0x46,0x5d,0x35,0x29,0x43,0x57,0xf6,0x88,
+    0x78,0x84,0x5a,0x9d,0x85,0xac,0x28,0xfc,0xaa,0x58,0x14,0xa9,0x50,0x8e,0x9b,0x35,
+    0x93,0x29,0xea,0x6a,0x6c,0xed,0x7d,0xa5,0x38,0x3a,0x6b,0x1d,0x68,0x00,0x46,0x1f,
+    0xda,0x65,0x97,0xb4,0x19,0x1c,0xba,0xd3,0x86,0xa2,0x15,0x1b,0xaa,0xf0,0x81,0x49,
+    0x48,0x2e,0x39,0x33,0x3f,0x37,0x12,0xe1,0x4c,0xa0,0xa3,0x8e,0x21,0x14,0x99,0x7d,
+    0xb9,0xfc,0x2e,0x6d,0x77,0x9e,0xf5,0xa9,0xc3,0xc1,0x0e,0x00,0x0a,0x1c,0xf4,0xd9,
+    0xf1,0x0e,0xa0,0xe3,0xc0,0xf2,0x38,0x6a,0x18,0x14,0xa5,0xbc,0x27,0x71,0x0f,0xde,
+    0xe7,0x69,0xec,0x37,0x01,0x0e,0x2b,0x56,0xf1,0xa2,0xa6,0xa1,0x25,0x58,0x90,0x80,
+    0x9e,0x16,0xc6,0x88,0x75,0x86,0xb3,0x8a,0xc0,0xfa,0x45,0x56,0x8f,0x3a,0xe6,0x56,
+    0x96,0x2c,0x99,0xe2,0x12,0xb4,0xf9,0xcc,0x82,0x9c,0x76,0xa5,0x5e,0x39,0x64,0x3b,
+    0xe8,0x6b,0x32,0xfc,0xf6,0x5e,0x7c,0x50,0xb4,0xab,0xed,0xb8,0x45,0x3a,0x57,0x3d,
+    0x6f,0x1e,0xf3,0x0e,0xdd,0x5a,0x4d,0x97,0x9d,0x07,0x7e,0xfa,0xb5,0xe0,0xe2,0x5c,
+    0xf5,0x8e,0x78,0xe1,0x66,0xb9,0x2f,0x01,0x08,0xd7,0x6c,0xb0,0xfd,0x3b,0xcc,0x7d,
+    0x2c,0x03,0x48,0xd1,0xe1,0xd4,0xef,0x7c,0x81,0xca,0x4d,0x6f,0x5f,0x48,0x1a,0xb6,
+    0x5c,0xca,0x6d,0xcb,0x9a,0xa6,0x86,0x53,0x3f,0xd8,0x45,0xbc,0xda,0xe3,0x4b,0xb5,
+    0x47,0x95,0xea,0x08,0x4b,0xdc,0x31,0x82,0xb8,0x80,0x1b,0xee,0x80,0x16,0x78,0x32,
+    0xa4,0x55,0x43,0x86,0x41,0xbe,0x1b,0x6b,0xc5,0x0f,0x5a,0x42,0x92,0xaf,0x7b,0x4c,
+    0xd7,0xaf,0xe8,0x78,0x7a,0xfa,0xa2,0xc3,0x35,0xfa,0xea,0xfc,0xfc,0x3c,0xea,0x0c,
+    0x58,0x5f,0xd2,0xf1,0x8b,0x49,0x30,0x7b,0x96,0xb3,0xf9,0xf3,0xc9,0x50,0xe0,0x3c,
+    0x14,0x78,0x79,0x9b,0x3f,0x3b,0x63,0x43,0x81,0x97,0xa1,0xc0,0x7c,0xfe,0xed,0xcb,
+    0x49,0xab,0xa1,0x1f,0x3d,0x3b,0x7b,0xf6,0xec,0x45,0x14,0x54,0xc9,0x3b,0x80,0x9e,
+    0x8c,0x2f,0x3b,0xfb,0x63,0xa0,0x4f,0x23,0x2f,0xd4,0xc2,0x53,0xcb,0x03,0x1c,0x17,
+    0x00,0x10,0x94,0xa2,0x5b,0x96,0xdf,0x91,0x18,0xab,0xdc,0x05,0x51,0xda,0x91,0xa5,
+    0x96,0x92,0x17,0x49,0x57,0x24,0x51,0x1f,0xd4,0xc8,0x1a,0x36,0xbe,0x71,0xa8,0xef,
+    0xa1,0x35,0xa0,0xc0,0x6c,0xe0,0x32,0xc3,0x89,0x1f,0x34,0x60,0xa9,0x1c,0x2d,0x32,
+    0xc0,0xb3,0x3e,0x29,0xc8,0x2e,0xf5,0xeb,0x40,0xa1,0x5f,0xb6,0x77,0xb2,0xc2,0xc2,
+    0xbc,0x14,0xb2,0x80,0x96,0xe0,0x7a,0x72,0x93,0x92,0xc5,0x60,0x64,0x7a,0xd3,0x9e,
+    0x86,0xc1,0x66,0xcd,0x88,0x87,0xa8,0xd9,0x08,0xad,0xc9,0x72,0xc9,0xac,0xfd,0x15,
+    0xd8,0x4b,0x23,0xd8,0x0c,0x8e,0x86,0x79,0x34,0x23,0x8b,0x83,0x61,0x45,0x16,0x86,
+    0x73,0x05,0x73,0xbb,0x4e,0x13,0xc7,0xc4,0x3a,0xa6,0x03,0x42,0xcf,0x8b,0xa3,0x6a,
+    0xbc,0xf6,0x56,0x43,0x73,0xd8,0x35,0xae,0xde,0x32,0x73,0xe8,0x6a,0xc5,0x36,0xd4,
+    0x97,0x87,0x9f,0xa4,0x66,0x88,0x60,0xd7,0xfa,0xc0,0x4c,0x92,0x92,0x95,0x12,0x8e,
+    0x06,0xa3,0xf8,0xfe,0xf7,0xdf,0x51,0xf4,0x5f,0x00,0xd4,0x9a,0xd7,0xa1,0xde,0x16,
+    0x90,0x59,0xe0,0x5b,0x66,0xdd,0x56,0xf2,0xec,0x5e,0x14,0xae,0xa4,0xef,0x99,0x2b,
+    0xb3,0x4a,0xa8,0x78,0x3a,0x99,0xa4,0xf5,0x0b,0xdb,0xc4,0x93,0x34,0x5e,0x9f,0xa0,
+    0x21,0x4f,0x61,0x38,0x49,0x46,0xd1,0xd7,0xd1,0x40,0x43,0x18,0xdc,0x75,0xe6,0xf4,
+    0x4f,0x62,0x03,0xf1,0x9c,0x26,0x23,0x34,0x73,0x76,0x14,0x05,0xcc,0x99,0x43,0x18,
+    0x00,0x1b,0xf4,0xf2,0xd3,0x8a,0x9b,0xed,0x15,0x97,0x3c,0x87,0x92,0x1a,0x47,0xd9,
+    0x5c,0x48,0x19,0x01,0x0a,0x6e,0xe3,0x8e,0x4d,0xc3,0x30,0xce,0xda,0x55,0x75,0x6c,
+    0x16,0x86,0xa3,0xe4,0x8b,0x71,0x82,0x74,0x3f,0x82,0x12,0xd8,0xf5,0x45,0x30,0x05,
+    0x2a,0x96,0x1c,0xda,0x26,0xe5,0x92,0x7d,0xb8,0x7a,0x55,0x98,0x57,0x0b,0xa3,0x57,
+    0xaa,0xa0,0x61,0x05,0xe9,0x45,0xc1,0xaf,0x01,0xb4,0x5d,0x4d,0x79,0x1d,0x41,0x7f,
+    0x04,0x66,0x2b,0xf0,0x11,0x08,0x78,0x11,0xaf,0x47,0x11,0x29,0xbe,0xaf,0xc8,0x09,
+    0x89,0x46,0x45,0x26,0xe1,0xf4,0x90,0x81,0x1e,0xdf,0x08,0x57,0x58,0x24,0xdd,0x76,
+    0xc9,0xa1,0x29,0x2a,0x10,0x94,0x8a,0x99,0x2d,0xa5,0x34,0x82,0x73,0x05,0xd2,0x3e,
+    0xc2,0x16,0xb9,0xda,0x4b,0xd3,0x46,0xea,0x78,0x04,0xfd,0xe1,0x78,0x18,0xc2,0xdc,
+    0x6d,0x30,0x0a,0xd0,0x91,0x7a,0x3d,0x50,0x0e,0xa2,0xd3,0xa2,0x0f,0xc0,0xa0,0x49,
+    0x8a,0xcb,0x64,0x3f,0x0c,0x1f,0x71,0xb1,0x07,0x39,0x25,0x6f,0xf1,0xb9,0xe4,0x62,
+    0x51,0xba,0x94,0x28,0x5a,0x66,0x6c,0xbd,0x00,0xe7,0xd4,0xc2,0x95,0xbd,0x73,0xd8,
+    0x97,0x49,0x4d,0x7f,0x56,0x73,0x01,0x64,0xdb,0xa6,0xa4,0x14,0x74,0xdc,0xbe,0xf5,
+    0x62,0xd8,0x82,0xa1,0xa8,0xa0,0x93,0x99,0x78,0xa5,0x66,0x62,0x34,0xaa,0x5b,0x30,
+    0x1f,0xc7,0x6b,0x71,0xf3,0x98,0xfa,0x46,0x0e,0x06,0x41,0x5b,0x17,0x5f,0xa9,0xd3,
+    0x56,0x00,0x8e,0x58,0x50,0xdd,0x05,0xbb,0x14,0xa9,0x7f,0xa8,0x67,0x76,0x41,0xb9,
+    0x00,0x04,0x32,0x7f,0xb0,0xfc,0x0e,0xe1,0x01,0x52,0x4c,0xd2,0x8f,0xe9,0xdb,0x61,
+    0x38,0xa4,0xbe,0x2c,0xc5,0x7e,0xcb,0xef,0x67,0x60,0x0b,0x4a,0xa5,0x06,0x33,0x4a,
+    0x31,0xa2,0x53,0xe8,0x3b,0xf5,0x18,0x7f,0x76,0x7b,0x38,0x6d,0xa8,0xa0,0x97,0xea,
+    0x72,0xfa,0x5a,0x3c,0x8d,0x3f,0x8e,0xa7,0xc9,0x49,0xac,0xe0,0xff,0xc5,0xc7,0x93,
+    0xd3,0x94,0x6c,0xe9,0x9a,0x5e,0xbe,0x1d,0x9f,0x8e,0xe3,0xf5,0x18,0x54,0x3d,0x8d,
+    0xdf,0x8e,0xcf,0x40,0xa0,0x14,0xf8,0x36,0x1b,0xd8,0x89,0x99,0x75,0x85,0x6c,0xa4,
+    0x91,0x59,0xdc,0xb2,0xf8,0xfc,0x45,0x3a,0x3d,0x7f,0x9e,0xbe,0x9c,0xa4,0xd9,0xe9,
+    0xf3,0x24,0xfa,0x1f,0xf8,0x75,0x6a,0xbd,0xf7,0x9b,0x58,0x24,0xe3,0x69,0xba,0x8d,
+    0x3b,0xac,0xd2,0xd3,0x3e,0x61,0x9a,0x89,0x1a,0xde,0x71,0x20,0xe4,0xbb,0xa3,0x81,
+    0xa1,0xc0,0x52,0x7d,0xc7,0x1b,0x53,0xbb,0xc3,0xd2,0x4f,0xdd,0x42,0x03,0xa1,0x7e,
+    0x03,0x9d,0x71,0x52,0xb7,0xe9,0x78,0x2b,0x09,0xda,0x98,0x7f,0x35,0xbf,0x9b,0xad,
+    0x91,0x47,0x7a,0xc1,0xe6,0xb4,0x23,0x42,0xaf,0x07,0x41,0x77,0x42,0xf9,0x33,0x6b,
+    0xb8,0x0a,0x64,0x6a,0x97,0xf1,0xda,0xf1,0x87,0xf6,0x0e,0x7b,0xaf,0x6a,0x65,0xe8,
+    0x88,0x3f,0x3e,0x50,0xa4,0xd2,0xeb,0xe3,0x22,0x81,0x4a,0xdc,0xb3,0xed,0xa1,0x9a,
+    0xac,0x3b,0x82,0x43,0xdc,0xad,0x69,0x67,0xbb,0x8e,0x3b,0x38,0x24,0xa0,0x8f,0xea,
+    0x0a,0x52,0x38,0xbc,0x4e,0xea,0x5e,0x7c,0xaf,0x28,0xb6,0xf7,0x98,0xfe,0xa4,0x5a,
+    0x39,0x57,0xb7,0x07,0x7b,0x29,0x5e,0xd0,0x63,0x7a,0x73,0xad,0x25,0xf4,0x74,0x0a,
+    0xce,0xa5,0x49,0xd4,0x84,0x02,0x8e,0x45,0x07,0x90,0x3f,0xea,0x8e,0x8a,0xc3,0xc6,
+    0x39,0x97,0xd0,0x58,0x45,0xa9,0xbf,0xe3,0xf8,0x8b,0xe2,0x1e,0xd3,0x95,0xbe,0xa7,
+    0x6f,0x98,0xe3,0x19,0x3c,0xc4,0xc3,0x34,0xca,0x0b,0x2c,0x6a,0x30,0x3e,0xc6,0x7d,
+    0x5e,0xe5,0xc5,0x61,0x4a,0x79,0x03,0x40,0x02,0xc3,0x90,0x41,0xd5,0x64,0xb7,0x70,
+    0x3e,0xef,0x21,0xec,0x9b,0xf5,0xf0,0x4a,0x14,0x38,0x65,0x4d,0x7e,0x70,0xd5,0x09,
+    0xf6,0x87,0xaa,0xc9,0x1d,0x5e,0x21,0xa0,0xe7,0x8e,0xd1,0xfa,0x70,0x97,0xfa,0xa3,
+    0x08,0x08,0x35,0x1c,0x38,0x98,0xeb,0x82,0xf8,0x1f,0xa1,0x68,0xbb,0xcd,0xee,0x0b,
+    0xc9,0x21,0x82,0x6f,0x3e,0xbc,0x6f,0x6a,0xf6,0x3b,0xcd,0x0a,0x38,0x10,0xd2,0x1e,
+    0xc7,0x6e,0xd9,0xe0,0x58,0xfc,0x4e,0xca,0x38,0xba,0x46,0x1f,0xc7,0xd0,0x81,0xdf,
+    0x44,0x49,0x06,0x09,0xf2,0x23,0xf3,0xae,0xf7,0x11,0x68,0xda,0x3b,0xea,0x1b,0xbc,
+    0xeb,0x00,0x14,0x5c,0x33,0x1b,0x08,0xf9,0x86,0x91,0xde,0x61,0x38,0xfc,0x99,0x10,
+    0x7c,0xde,0xf0,0x53,0x38,0x31,0xa4,0x20,0x09,0x5a,0xff,0x2f,0x24,0x6d,0x7d,0x17,
+    0x68,0x70,0xe9,0xfa,0x74,0xfc,0x5e,0xb3,0x7f,0x81,0x4c,0x82,0x3b,0x32,0xc6,0x1a,
+    0x22,0xe0,0x5b,0xdf,0xfa,0xda,0xe4,0xef,0x51,0x15,0xdb,0x92,0x92,0xc1,0x7d,0xd9,
+    0x02,0x3a,0x44,0xc0,0x65,0xcb,0x5f,0x9a,0xfd,0x67,0x02,0x26,0x41,0xa4,0xd8,0x3e,
+    0xaa,0xb7,0xd9,0x25,0xb8,0xc1,0x3f,0xee,0xe5,0x2d,0xbe,0x1b,0x13,0x00,0x00,
+};
+const StaticAssets::Asset StaticAssets::bwiJs = {
+    "/static/bwi.js", "application/javascript", k_bwiJs, sizeof(k_bwiJs), "\"f9dff30e\"", "f9dff30e"
+};
+
+// assets/bwi.css: 1139 -> 512 bytes
+static const uint8_t k_bwiCss[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xa5,0x53,0xd1,0x8e,0x9b,0x30,
+    0x10,0x7c,0xef,0x57,0x20,0x9d,0x2a,0xb5,0x52,0x4d,0x39,0x12,0xa2,0xca,0x96,0xfa,
+    0x2f,0x36,0x5e,0xc3,0x36,0xc6,0x46,0xb6,0x13,0x48,0x51,0xff,0xbd,0x36,0xf1,0xa5,
+    0x90,0xf6,0xa1,0xd2,0xc9,0x2f,0x48,0xec,0xce,0xcc,0xce,0xce,0x96,0x62,0x42,0xa2,
+    0x41,0x2e,0x12,0xfd,0xa8,0xf9,0x8d,0xa2,0xd1,0x68,0x80,0x28,0x0d,0x33,0xe3,0x1a,
+    0x3b,0x43,0x30,0xc0,0xe0,0x69,0x0b,0x26,0x80,0x63,0x1d,0x1f,0xe9,0x69,0x9c,0x7f,
+    0x7d,0x28,0x73,0x63,0x51,0xa6,0xee,0x09,0x65,0xe8,0xe9,0x6b,0x3d,0xce,0xac,0x07,
+    0xec,0xfa,0x70,0xff,0x16,0xd6,0x49,0x70,0xc4,0x71,0x89,0x17,0x4f,0x9b,0xea,0x23,
+    0x7b,0xa2,0x11,0xda,0xb6,0x67,0x36,0x70,0xd7,0xa1,0xa1,0x55,0x71,0x1c,0xe7,0xa2,
+    0x2a,0x2a,0x26,0x78,0x7b,0xee,0x9c,0xbd,0x18,0x49,0x5f,0x84,0x4a,0x8f,0x5d,0xc1,
+    0x05,0x6c,0xb9,0x26,0xab,0x28,0x3a,0xa0,0x94,0x1a,0x22,0xc1,0x4c,0x7c,0xcf,0xa5,
+    0x9d,0x22,0xa2,0x87,0x90,0xba,0x8b,0xc8,0x5c,0xb8,0x4e,0xf0,0x4f,0xd5,0x97,0xf4,
+    0xca,0xe6,0xf3,0x56,0xae,0x35,0xa5,0x8b,0x8a,0xb7,0x14,0xf2,0x74,0x68,0x0f,0xed,
+    0x53,0x51,0xe7,0x00,0xcc,0xae,0xac,0x16,0xa2,0x3e,0xee,0xcb,0x94,0x5a,0xfe,0xd6,
+    0xba,0x33,0x47,0xe8,0x45,0x59,0x73,0xf7,0xe3,0xeb,0x6b,0x59,0x17,0x9e,0x1b,0x4f,
+    0x3c,0x38,0x54,0xcc,0x8e,0xbc,0xc5,0x70,0xa3,0xe5,0xb7,0x26,0xf7,0x08,0xee,0x96,
+    0xd1,0x7a,0x0c,0x68,0x0d,0x75,0xa0,0x79,0xc0,0x2b,0xb0,0xec,0x6e,0x15,0xfd,0xcb,
+    0xee,0xd6,0xc7,0xe4,0xee,0x76,0x04,0x29,0x9f,0xdc,0x4e,0x15,0x36,0xba,0xa6,0x74,
+    0x34,0xa7,0x8f,0x76,0x81,0xf9,0x43,0xf2,0x5d,0xe2,0x75,0x79,0xdb,0x54,0xc2,0xdd,
+    0x62,0x1d,0x5b,0xae,0x9a,0x8a,0xb5,0x56,0x5b,0x47,0x5f,0x94,0x52,0x2c,0xc0,0x1c,
+    0xb2,0xf1,0x39,0x07,0xeb,0xf6,0xb6,0x62,0xd2,0x90,0xc4,0xe3,0x4f,0x58,0x27,0xcd,
+    0x4c,0xce,0x7b,0xcc,0xd9,0x68,0xea,0x2a,0x56,0x0d,0x7c,0x26,0x9b,0x69,0xd6,0x26,
+    0xc5,0x07,0xd4,0x37,0xba,0xf1,0x65,0x8f,0xf5,0x16,0x8f,0x35,0x1c,0x1b,0xe0,0xa2,
+    0xec,0xa5,0x7b,0xe4,0x76,0x0d,0xec,0x8f,0x8b,0x0f,0xa8,0x6e,0xa4,0x8d,0x00,0x51,
+    0x27,0xf5,0xd1,0xe0,0x18,0x32,0x08,0x53,0xdc,0xe5,0xbf,0xe2,0x7c,0x87,0x26,0xc2,
+    0x86,0x60,0x07,0xba,0x17,0x5e,0x94,0xc1,0x45,0x57,0xfe,0x6b,0x1f,0xaf,0xa7,0x77,
+    0xec,0xe3,0x4e,0xa6,0x50,0xeb,0xed,0x4a,0x76,0x3f,0xfd,0x65,0x58,0xb2,0xd6,0x60,
+    0x47,0x7a,0x88,0x58,0x79,0x3d,0x4d,0xd3,0xb0,0xa9,0x8f,0x43,0x91,0x75,0x58,0x6a,
+    0xac,0x1b,0xb8,0x7e,0x30,0x91,0xc9,0xc5,0x8b,0xe5,0xe6,0x36,0xf5,0xe0,0x60,0xb7,
+    0xb6,0x18,0xc6,0x47,0xec,0x82,0x59,0x46,0x2e,0x25,0x9a,0x2e,0x5d,0x77,0xf1,0x64,
+    0x7b,0xae,0x8a,0x04,0xee,0xfc,0x30,0x7c,0x77,0xba,0xe9,0xe4,0xf6,0x67,0xab,0x4e,
+    0xe9,0x3d,0x79,0x70,0x48,0x58,0xbf,0x01,0x6f,0x9d,0x40,0x1d,0x73,0x04,0x00,0x00,
+};
+const StaticAssets::Asset StaticAssets::bwiCss = {
+    "/static/bwi.css", "text/css", k_bwiCss, sizeof(k_bwiCss), "\"33a199f9\"", "33a199f9"
+};
+
+// assets/status.js: 3352 -> 1281 bytes
+static const uint8_t k_statusJs[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0x56,0x51,0x6f,0xdb,0x36,
+    0x10,0x7e,0xcf,0xaf,0xb8,0x65,0x58,0x25,0xad,0xaa,0xe2,0x2c,0x49,0x93,0xd5,0x71,
+    0x80,0x36,0x4b,0xd1,0x0e,0xc9,0x52,0x20,0xc1,0x5e,0x8a,0x3d,0x30,0x14,0x65,0x73,
+    0xa5,0x45,0x95,0xa4,0xed,0x18,0x81,0xff,0xfb,0xee,0x48,0x49,0x96,0x1c,0x27,0xc8,
+    0x06,0xec,0x21,0x88,0x74,0xba,0xfb,0xbe,0xbb,0xe3,0x77,0x47,0x17,0xb3,0x92,0x3b,
+    0xa9,0x4b,0xe0,0x8a,0x4d,0xab,0x78,0x9e,0x82,0xd2,0x29,0x4c,0x64,0x02,0x0f,0x3b,
+    0x00,0x46,0xb8,0x99,0x29,0xe1,0x8a,0xb9,0x49,0x36,0x95,0x65,0x3c,0x91,0x69,0xfd,
+    0xc2,0xee,0x63,0x72,0x9c,0x27,0xc9,0x70,0x67,0xb5,0xb3,0x53,0x34,0x30,0x95,0x30,
+    0x5c,0x94,0xee,0x5c,0x2b,0x6d,0xe2,0x8a,0xbb,0x80,0x23,0x0b,0xa0,0x17,0x38,0x1b,
+    0xc1,0xdb,0x41,0xd2,0xc0,0x46,0x3f,0x1e,0x72,0x56,0x1c,0x0d,0xa2,0x61,0xdf,0xe5,
+    0xa0,0xeb,0x52,0x14,0xbf,0x9e,0x0c,0x82,0xcb,0xda,0x76,0x78,0x78,0x70,0xf0,0x36,
+    0xea,0x33,0x3b,0x31,0xad,0x02,0xad,0x7f,0x5a,0x13,0xfb,0x57,0x38,0x05,0x44,0x5d,
+    0x43,0x1c,0x1f,0x1f,0xb7,0xb4,0x8d,0xc3,0xd1,0xd1,0xd3,0xa9,0x35,0x3e,0xc7,0xdd,
+    0xdc,0x4e,0xee,0xf8,0xc1,0x21,0x7b,0xe4,0x73,0x72,0xf4,0x5f,0xf2,0xb7,0xc2,0x7d,
+    0x60,0x26,0x96,0x79,0x0a,0xd8,0x87,0x14,0x38,0xd5,0x12,0xaa,0xe0,0xba,0xb4,0x0e,
+    0xee,0x98,0x81,0x11,0xe4,0x9a,0xcf,0xa6,0xd8,0xe1,0x6c,0x2c,0xdc,0x85,0x12,0xf4,
+    0xf8,0x61,0xf9,0x39,0xc7,0xb8,0xa4,0xc9,0xe3,0x07,0xf4,0x6c,0x32,0x20,0x1b,0xbe,
+    0x66,0xd6,0x2d,0x95,0xc8,0x16,0x32,0x77,0x13,0x04,0x09,0x87,0xed,0x69,0x06,0x29,
+    0xec,0x0f,0xb0,0xa8,0xd7,0x10,0xfd,0x14,0xf5,0xbd,0xef,0x18,0xff,0x36,0x36,0x7a,
+    0x56,0xe6,0x14,0x42,0xe9,0xf4,0x33,0x66,0x55,0xa5,0x96,0x37,0x8e,0xb9,0x99,0x8d,
+    0xf3,0x6e,0xa6,0x13,0xc1,0xaa,0x5b,0xed,0x98,0xc2,0xb8,0x56,0x2e,0xfb,0x58,0x17,
+    0x33,0x56,0x7c,0x54,0x9a,0xb9,0x38,0xcf,0x5a,0x27,0x92,0x50,0x2f,0xf4,0x0b,0xca,
+    0xa0,0xcd,0x71,0x33,0x24,0x81,0xbd,0x0e,0xfe,0xcf,0x94,0x7c,0x5b,0xc4,0xb0,0x85,
+    0x41,0xc2,0xf7,0x4a,0x69,0xfe,0x24,0x54,0xe3,0xf0,0x3c,0x5c,0x8b,0x17,0x8e,0x76,
+    0xd4,0xaf,0x20,0xe8,0x6c,0xd8,0x73,0xea,0x12,0xc6,0xe1,0x9f,0x77,0x4b,0xe1,0x97,
+    0xa6,0xd3,0x6f,0xf0,0x91,0x68,0x4f,0x06,0xdb,0xf8,0x6a,0x19,0x44,0x94,0x14,0x3e,
+    0x44,0x69,0xd3,0x92,0xb4,0x3f,0x5b,0xb5,0x35,0xf1,0xfc,0x4d,0x50,0x53,0x55,0x08,
+    0xec,0x34,0x61,0x23,0xb8,0xf3,0xa5,0x0f,0x40,0xb9,0x86,0xe0,0xba,0x98,0xf4,0xd1,
+    0x5c,0x85,0x34,0x9f,0x92,0xa1,0xcf,0xfb,0x4f,0xa6,0xa2,0x24,0x93,0x65,0x29,0xcc,
+    0xad,0xb8,0xc7,0x86,0x60,0x00,0x86,0xf8,0xf3,0x23,0xa1,0xc1,0x37,0x2c,0x3f,0xc2,
+    0xa7,0xba,0x88,0xcc,0xe9,0x8f,0xf2,0x5e,0xe4,0xf1,0x5a,0x87,0xcf,0x51,0x34,0xd9,
+    0x3f,0x45,0xd3,0x7c,0xef,0x51,0x75,0x4a,0xfe,0x97,0x74,0x54,0xf6,0x76,0x2a,0xdf,
+    0x90,0x16,0x6d,0xdf,0xa3,0xc1,0x79,0xb4,0x65,0x4a,0x2e,0xf5,0x38,0x76,0xf7,0xae,
+    0x3b,0x24,0xfc,0x99,0x61,0x8e,0x94,0x1e,0x9f,0xeb,0xd2,0x31,0x89,0x84,0xd1,0x7a,
+    0xb0,0x79,0x77,0xac,0x79,0xc8,0xe7,0xd3,0xed,0xd5,0x25,0x42,0x21,0x7a,0x30,0x5a,
+    0x6e,0xb4,0x52,0xb7,0xba,0x22,0x1d,0xd6,0x6f,0x9f,0x84,0x1c,0x4f,0x9c,0xcf,0x6b,
+    0x6f,0x0f,0x76,0x11,0x7d,0x17,0xc4,0x1c,0xd9,0x2c,0x70,0x66,0xcc,0x12,0x74,0xa9,
+    0x96,0xe0,0x26,0x02,0xd0,0x66,0xa4,0x40,0xf3,0x84,0x95,0x63,0x91,0x83,0x95,0x25,
+    0x17,0xfe,0x4b,0x65,0xc4,0x5c,0xea,0x99,0x45,0x5f,0xf1,0x0e,0x58,0x49,0x48,0xe4,
+    0xbd,0xc4,0x94,0x2a,0xc5,0x38,0x06,0x91,0x9b,0x9d,0xe8,0x45,0x49,0x3e,0xb0,0x90,
+    0xb8,0x6b,0xbc,0x89,0x4d,0x05,0xe4,0xcc,0xb1,0x37,0x56,0x7c,0xc7,0xc8,0x9c,0xb8,
+    0xcd,0xd2,0x4d,0x64,0x39,0x06,0x56,0x38,0x61,0x08,0x4b,0xa2,0xd6,0x1a,0x76,0xad,
+    0x72,0x61,0x30,0x96,0x95,0x21,0xae,0x90,0x86,0x76,0x03,0x9b,0x0b,0x50,0xa2,0x70,
+    0x1e,0x35,0xc7,0x74,0xb8,0x88,0x2c,0x18,0x84,0x59,0xb7,0x7b,0x2a,0xcc,0x58,0xfc,
+    0x2f,0xed,0x0e,0x33,0xde,0x85,0xe1,0x46,0x30,0x27,0x6a,0xa4,0x20,0x14,0x85,0x86,
+    0x80,0xe0,0xb6,0x1e,0x4f,0xb3,0xe4,0x68,0xa5,0x22,0x00,0x92,0x12,0xd0,0xf7,0x19,
+    0xf6,0xe3,0x46,0x28,0xc1,0x1d,0xce,0x59,0xa4,0xe4,0xd7,0xa6,0x5d,0x7f,0x75,0xd2,
+    0xa1,0x30,0x2c,0x69,0xe3,0xe0,0xa3,0x68,0xd8,0x64,0x09,0x2b,0x14,0x25,0xb6,0x92,
+    0xda,0x83,0x25,0x81,0xb4,0x80,0x29,0xb9,0x65,0x4b,0x5c,0x18,0x3d,0xc5,0x90,0xd7,
+    0x84,0x94,0x11,0x05,0xce,0x7d,0x86,0x2c,0x29,0x84,0x0e,0x6f,0x7e,0xf2,0x56,0xe2,
+    0x7f,0x6f,0x0c,0x5b,0x66,0x14,0x1e,0xf3,0x8c,0x4f,0xa4,0xca,0x8d,0x28,0x93,0xac,
+    0xd0,0xe6,0x82,0xf1,0x49,0xac,0x24,0x8c,0xce,0x7c,0xb3,0x1b,0x26,0x4b,0x58,0x4a,
+    0x76,0x49,0x86,0xfe,0xb3,0xaf,0x24,0xb6,0x74,0xcf,0x07,0xce,0x57,0xaf,0xd0,0xf9,
+    0xd4,0xa7,0x96,0x24,0x80,0x21,0x46,0x4c,0xf5,0x5c,0xc4,0xbe,0xee,0x55,0x58,0xaf,
+    0x19,0x0e,0x91,0x28,0xf3,0x73,0x22,0x8e,0xdb,0xb6,0x25,0x2f,0x12,0x7c,0xab,0x8c,
+    0x59,0x85,0xc9,0x88,0xfa,0xbe,0xb2,0xfe,0xdf,0x17,0xbc,0x9c,0x82,0x48,0x0a,0xe1,
+    0xb0,0x8e,0x8e,0xd5,0x27,0x9b,0x61,0x27,0xcb,0xd8,0x50,0x71,0x26,0xfb,0xdb,0xea,
+    0x32,0x4e,0xba,0x1f,0x3a,0x17,0x60,0x6d,0xe6,0x8c,0x60,0x84,0xef,0xc6,0x2a,0xd9,
+    0xc6,0x4f,0xd2,0xc4,0xb3,0xd9,0x64,0x6e,0x4c,0x8f,0x69,0x1d,0xee,0x9b,0x2d,0xb4,
+    0x88,0xf3,0x02,0x4e,0x59,0x4a,0xd7,0x54,0x4c,0xf8,0xf8,0xf3,0x6e,0xcd,0x8c,0x4a,
+    0x69,0x67,0x34,0x97,0x16,0xb5,0xbb,0x0c,0x5b,0x01,0xac,0x43,0x65,0x4f,0x21,0xbe,
+    0x5b,0x48,0x2c,0x3b,0xad,0x87,0xd7,0x8a,0x04,0x34,0x9e,0x43,0x0a,0xa1,0x4f,0x7e,
+    0x94,0x31,0xf1,0x00,0x85,0x7b,0x44,0xe2,0x7c,0x12,0xa9,0x03,0x66,0x61,0x37,0x38,
+    0xed,0x42,0x7f,0xe1,0x0c,0xa1,0xc2,0xf3,0xa1,0xc9,0xe7,0x78,0xca,0x26,0x2c,0x8d,
+    0x31,0xab,0x6c,0xad,0xf2,0x85,0x2c,0x73,0xbd,0xc8,0x90,0xf9,0xba,0x4c,0x6a,0x49,
+    0xf9,0x97,0x38,0x0a,0x80,0x74,0x37,0xf9,0x5a,0x81,0x76,0xcf,0x43,0xef,0x57,0xc8,
+    0xef,0x37,0xd7,0x7f,0x64,0xfe,0x8e,0x8e,0xe9,0x62,0xc3,0x79,0xf0,0xcd,0x81,0x18,
+    0x33,0x7f,0x58,0xd5,0x6a,0x6a,0xf1,0x30,0x2b,0xba,0x25,0xeb,0x85,0x11,0xf4,0xd6,
+    0x8e,0x8a,0xa2,0x62,0x46,0x10,0x27,0xc4,0xb5,0x4e,0xea,0x92,0xcc,0x28,0xd9,0xfa,
+    0x31,0xa8,0xb4,0xaf,0x2c,0xdf,0xe0,0xb5,0xd9,0x1f,0x78,0x6b,0xc3,0x59,0xf8,0x8c,
+    0xe2,0x35,0x73,0xa6,0xe2,0x80,0xfd,0x10,0x46,0x42,0x79,0xb4,0x64,0x2b,0x16,0xac,
+    0x52,0x38,0x1a,0xd4,0x3f,0x70,0x5e,0x88,0xd0,0xa1,0xed,0x84,0x87,0x0b,0x80,0x5a,
+    0x5e,0x18,0x36,0xa6,0xb5,0xe5,0x2f,0x00,0xda,0xb9,0x12,0x2f,0x03,0x9c,0xb1,0x4a,
+    0x4b,0x3c,0xa5,0x77,0x70,0x9a,0xcb,0x39,0xfd,0x8e,0xb1,0x76,0x54,0x9f,0x24,0xae,
+    0x23,0x2f,0xaa,0xdd,0x5a,0x0e,0xc1,0x58,0x21,0xc5,0x28,0xcb,0x82,0x0d,0x3b,0xda,
+    0x18,0xce,0x76,0xda,0x35,0xc9,0xf2,0xfc,0x82,0xce,0xfe,0x52,0x5a,0x1c,0x5b,0x81,
+    0x0b,0xee,0xb7,0xeb,0xab,0xf3,0x30,0xc3,0x97,0x9a,0xe5,0x22,0xc7,0x63,0xa8,0x4b,
+    0xe9,0x5e,0xc4,0xbd,0xad,0x88,0x97,0x77,0x1c,0x7d,0xdd,0x64,0xc6,0xf5,0xd8,0x2e,
+    0x21,0xa1,0xd6,0x4b,0xa8,0xa3,0x7b,0xa1,0xd6,0x4b,0xa8,0x1d,0x6f,0xbc,0x6a,0xd6,
+    0xe6,0x66,0xf6,0x9a,0x85,0x43,0x7f,0xff,0x00,0xc1,0xa5,0x04,0xcc,0x18,0x0d,0x00,
+    0x00,
+};
+const StaticAssets::Asset StaticAssets::statusJs = {
+    "/static/status.js", "application/javascript", k_statusJs, sizeof(k_statusJs), "\"d882fb43\"", "d882fb43"
+};
+
+// assets/status.css: 834 -> 401 bytes
+static const uint8_t k_statusCss[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x75,0x92,0x4d,0x6e,0xc3,0x20,
+    0x10,0x85,0xf7,0x3e,0x05,0x52,0xd4,0x5d,0x88,0x9c,0xb4,0x4d,0x54,0xb2,0xaa,0x7a,
+    0x12,0x6c,0xc6,0xf6,0xb4,0x18,0xd0,0x80,0xe3,0xa4,0x55,0xee,0x5e,0x20,0x4e,0xf3,
+    0xd3,0x56,0x96,0xb0,0xfc,0x98,0xe1,0xbd,0x8f,0x71,0x65,0xd5,0x81,0x7d,0x15,0x8c,
+    0x35,0xd6,0x04,0xde,0xc8,0x1e,0xf5,0x41,0xb0,0x57,0x42,0xa9,0xe7,0xcc,0x4b,0xe3,
+    0xb9,0x07,0xc2,0x66,0x5b,0x1c,0x8b,0x62,0xe1,0x83,0x0c,0x43,0x52,0xea,0x80,0xd6,
+    0xe4,0x36,0x85,0xde,0x69,0x19,0x5b,0x1a,0x0d,0xfb,0x6d,0x3a,0x27,0xbe,0xf9,0x48,
+    0xd2,0x09,0x96,0xd6,0x24,0xbd,0x0f,0x3e,0x60,0x73,0xe0,0x75,0xb4,0x00,0x13,0x04,
+    0xab,0xe3,0x0a,0x94,0xb6,0xda,0x54,0xb7,0x5c,0xb9,0xdc,0xda,0x4b,0x6a,0xd1,0xf0,
+    0xca,0x86,0x60,0x7b,0xc1,0x56,0x65,0x92,0xaf,0x7c,0xd3,0x79,0x0e,0x28,0xfb,0x8e,
+    0xa8,0x42,0x17,0x6b,0xd6,0xe5,0xb9,0x37,0xba,0x9e,0xb4,0x65,0x59,0x3e,0x6c,0xef,
+    0x89,0xae,0x51,0xa6,0x2d,0x8f,0x9f,0x70,0x6f,0x2e,0xd8,0x93,0xdb,0xb3,0xf2,0xc6,
+    0x96,0xec,0xf8,0x37,0xea,0x2f,0x2e,0xef,0x64,0x0d,0xbc,0x82,0x30,0x02,0x98,0x54,
+    0x21,0x35,0xb6,0x86,0x63,0x80,0xde,0x5f,0x53,0xdf,0x83,0xde,0x71,0x56,0x92,0xf2,
+    0x99,0x12,0xcd,0x44,0xeb,0xac,0xc7,0x74,0xe5,0x82,0x11,0x68,0x19,0x70,0x07,0xdb,
+    0xcb,0x1d,0x9c,0x79,0x3b,0xc0,0xb6,0x8b,0x29,0x96,0xeb,0x13,0x51,0x25,0xeb,0x8f,
+    0x96,0xec,0x60,0x94,0x60,0x33,0xa5,0x54,0xd6,0x2c,0x29,0x20,0x4e,0x52,0xe1,0xe0,
+    0x33,0x6c,0x52,0xed,0x0e,0xa8,0xd1,0x76,0x14,0xac,0x43,0xa5,0x52,0xf4,0x7f,0xd3,
+    0x2c,0x1a,0xd4,0x3a,0x67,0xfa,0xb1,0x9b,0xec,0xa7,0x34,0xa7,0x8f,0x1b,0xef,0xcd,
+    0x66,0x93,0xb4,0x40,0x71,0x06,0x13,0x46,0x2e,0x66,0xe5,0xe2,0xd9,0xcf,0xaf,0x6a,
+    0xb3,0x90,0xcd,0x67,0xda,0xb6,0x6f,0x37,0x57,0x70,0xa9,0x8a,0x69,0xb4,0xa5,0x78,
+    0x6e,0xf3,0x92,0x9e,0x0b,0x56,0xcc,0x12,0x87,0xe7,0xad,0x46,0xc5,0x66,0x75,0x5d,
+    0xa7,0x1d,0x27,0x95,0x42,0xd3,0xa6,0x98,0x27,0xd6,0x73,0xec,0xc7,0xb2,0xbc,0x85,
+    0xe7,0x71,0xb2,0x72,0x08,0x36,0xb3,0x74,0x71,0x66,0x3c,0x8f,0x53,0x30,0x47,0xc0,
+    0xcf,0xbf,0xf2,0xaf,0x1f,0xe7,0x58,0x7c,0x03,0x77,0xa4,0xb6,0xe7,0x42,0x03,0x00,
+    0x00,
+};
+const StaticAssets::Asset StaticAssets::statusCss = {
+    "/static/status.css", "text/css", k_statusCss, sizeof(k_statusCss), "\"147bccc0\"", "147bccc0"
+};
+
+// assets/login.html: 658 -> 422 bytes
+static const uint8_t k_loginHtml[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x65,0x52,0x4d,0x6f,0xdb,0x30,
+    0x0c,0xbd,0xfb,0x57,0x68,0x27,0xb5,0xc0,0x62,0xb7,0x5b,0x57,0xa0,0x8e,0xec,0xc3,
+    0x80,0x1d,0x06,0x14,0x58,0xb0,0xb6,0x3f,0x80,0xb6,0x68,0x5b,0x80,0xbe,0x2a,0xd1,
+    0x49,0xbc,0x74,0xff,0x7d,0xb2,0x9d,0xa0,0x1b,0x76,0xa3,0x1e,0xc9,0xf7,0xc8,0x47,
+    0x89,0x0f,0xd2,0xb5,0x34,0x79,0x64,0x03,0x19,0x5d,0x0b,0x83,0x04,0xcc,0x82,0xc1,
+    0x6a,0xaf,0xf0,0xe0,0x5d,0x20,0xd6,0x3a,0x4b,0x68,0xa9,0xe2,0x07,0x25,0x69,0xa8,
+    0x24,0xee,0x55,0x8b,0x9b,0xe5,0xf1,0x91,0x29,0xab,0x48,0x81,0xde,0xc4,0x16,0x34,
+    0x56,0xb7,0xbc,0xa8,0x33,0x11,0x69,0xd2,0x58,0x37,0x4e,0x4e,0xa7,0x2e,0xf5,0x6e,
+    0x3a,0x30,0x4a,0x4f,0x65,0x04,0x1b,0x37,0x11,0x83,0xea,0xb6,0x06,0x8e,0x2b,0x41,
+    0x79,0xf7,0xe9,0xc6,0x1f,0xd3,0x3b,0xf4,0xca,0x96,0x77,0x68,0x18,0x8c,0xe4,0xb6,
+    0x1e,0xa4,0x54,0xb6,0x2f,0x6f,0xd8,0x2d,0x9a,0xdf,0x9d,0x0b,0xe6,0x24,0x55,0xf4,
+    0x1a,0xa6,0xb2,0x0f,0x4a,0x6e,0x7b,0xf0,0x65,0x7e,0x9f,0x52,0x1a,0x1a,0xd4,0xab,
+    0x4a,0x54,0xbf,0xb0,0xcc,0x1f,0x12,0xa8,0xac,0x1f,0xe9,0x74,0xe1,0xc8,0xbf,0x24,
+    0xa8,0x19,0x89,0x9c,0x7d,0xc7,0x52,0xef,0x42,0x2d,0x8a,0x75,0xd8,0x4c,0x0c,0x9f,
+    0xeb,0x47,0x97,0x86,0x10,0x45,0x8a,0x32,0x31,0x6b,0xb2,0x64,0xc6,0xe0,0x64,0xc5,
+    0x77,0x3f,0x9e,0x9e,0x39,0x83,0x96,0x94,0xb3,0x15,0x2f,0xf4,0x5c,0xc7,0xeb,0x8c,
+    0x31,0xb1,0xe8,0xd7,0x2f,0x69,0x2b,0xd1,0x84,0xa2,0x16,0x8b,0x34,0x9b,0xfd,0xac,
+    0x38,0xe1,0x91,0xf8,0xea,0x25,0x1f,0xf9,0xb2,0x58,0xe7,0xda,0x31,0xd6,0xa2,0x58,
+    0xdb,0xde,0x09,0x76,0x10,0xe3,0xc1,0x05,0xf9,0x3f,0x89,0x3f,0x67,0x2e,0x44,0x9e,
+    0xff,0xd3,0xfe,0x77,0xe9,0xa0,0xa4,0x44,0x7b,0x29,0xb4,0x8b,0xba,0x92,0xe7,0x68,
+    0xa9,0x5e,0x5d,0x38,0x97,0xc7,0xb1,0x31,0x2a,0x25,0xce,0x5b,0xaf,0xb9,0xb4,0x79,
+    0x31,0xaf,0x3e,0x5f,0xb1,0x0d,0xca,0x53,0x9d,0xae,0x1f,0x89,0xbd,0xfa,0xca,0xe2,
+    0x81,0xbd,0xfc,0x7c,0x7c,0x42,0x08,0xed,0xb0,0x83,0x00,0x26,0x5e,0x69,0xd7,0xc2,
+    0x6c,0x4a,0x1e,0x17,0xf4,0x7a,0x9b,0x3e,0xd3,0x68,0xd2,0x67,0xc9,0x7b,0xa4,0x6f,
+    0x1a,0xe7,0xf0,0xeb,0xf4,0x5d,0x5e,0xad,0x43,0x5c,0xe7,0x7b,0xd0,0x23,0x56,0xaf,
+    0x7e,0xce,0x5f,0xc0,0xb7,0x37,0x5e,0xf0,0x74,0x88,0x55,0x2f,0xfb,0x03,0x43,0x52,
+    0x0a,0xfe,0x92,0x02,0x00,0x00,
+};
+const StaticAssets::Asset StaticAssets::loginHtml = {
+    nullptr, "text/html", k_loginHtml, sizeof(k_loginHtml), "\"de47fb41\"", "de47fb41"
+};
+
+// assets/ota.html: 948 -> 576 bytes
+static const uint8_t k_otaHtml[] PROGMEM = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x6d,0x53,0x4d,0x4f,0xdc,0x30,
+    0x10,0xbd,0xef,0xaf,0x18,0x54,0xb5,0x01,0x89,0xec,0x6e,0x90,0x8a,0x50,0x48,0x22,
+    0xf5,0xd2,0x53,0x25,0x50,0x0b,0x27,0xc4,0x61,0x62,0x4f,0x88,0x85,0x13,0xbb,0xf6,
+    0x64,0x3f,0xba,0xe2,0xbf,0xd7,0x8e,0x97,0x6d,0x2b,0xf5,0x12,0x67,0xc6,0xf3,0x9e,
+    0x3d,0xef,0x8d,0xab,0x33,0x69,0x04,0xef,0x2d,0x41,0xcf,0x83,0x6e,0xaa,0xe3,0x97,
+    0x50,0x36,0xd5,0x40,0x8c,0x20,0x7a,0x74,0x9e,0xb8,0xce,0x26,0xee,0xf2,0x9b,0xac,
+    0x59,0xa4,0xf4,0x88,0x03,0xd5,0xd9,0x46,0xd1,0xd6,0x1a,0xc7,0x19,0x08,0x33,0x32,
+    0x8d,0xa1,0x6c,0xab,0x24,0xf7,0xb5,0xa4,0x8d,0x12,0x94,0xcf,0xc1,0xa5,0x1a,0x15,
+    0x2b,0xd4,0xb9,0x17,0xa8,0xa9,0x2e,0x22,0x07,0x2b,0xd6,0xd4,0xdc,0x3d,0x7c,0x81,
+    0x47,0x2b,0x91,0xa9,0x5a,0xa5,0xcc,0xa2,0xf2,0xbc,0x8f,0x6b,0x6b,0xe4,0xfe,0xd0,
+    0x05,0xd2,0xbc,0xc3,0x41,0xe9,0x7d,0xe9,0x71,0xf4,0xb9,0x27,0xa7,0xba,0xdb,0x01,
+    0x77,0x89,0xb9,0xbc,0xbe,0x59,0xdb,0x5d,0x88,0xdd,0x8b,0x1a,0xcb,0x2b,0x47,0x03,
+    0xe0,0xc4,0xe6,0xd6,0xa2,0x94,0x6a,0x7c,0x29,0xd7,0x50,0x84,0xdc,0xdb,0xa2,0x2f,
+    0x12,0x95,0x57,0xbf,0xa8,0x2c,0x96,0xd7,0x73,0x72,0xd9,0x9a,0xdd,0xa1,0x35,0x4e,
+    0x92,0x2b,0x0b,0xbb,0x03,0x6f,0xb4,0x92,0xf0,0x41,0x08,0x71,0xc2,0x47,0xf4,0x6d,
+    0x2a,0xc9,0x1d,0x4a,0x35,0xf9,0x72,0xf9,0x79,0x06,0x6b,0x6c,0x49,0x1f,0xa4,0xf2,
+    0x56,0xe3,0xbe,0x6c,0xb5,0x11,0xaf,0xef,0xd7,0x98,0x2b,0x60,0x0d,0xcb,0xab,0x54,
+    0xaa,0x46,0x3b,0xf1,0x53,0x94,0xb8,0xb6,0xe8,0xfd,0x36,0xd0,0x3d,0x5f,0xfe,0x95,
+    0xec,0x94,0xa6,0xe7,0x43,0xea,0xa7,0x58,0xaf,0x3f,0xbe,0x2d,0xda,0x89,0xd9,0x8c,
+    0x87,0xc4,0x97,0xb3,0xb1,0x65,0x6a,0xa3,0x5a,0x25,0x71,0xaa,0x55,0xf2,0x27,0x6a,
+    0x14,0x14,0xeb,0x8b,0xe6,0xab,0x72,0xc3,0x16,0x1d,0x41,0x50,0x34,0xec,0x16,0x21,
+    0x2b,0xd5,0x06,0x84,0x0e,0x07,0xd6,0x59,0x68,0x34,0x6a,0x7e,0x96,0xe7,0x40,0x83,
+    0xe5,0x3d,0xa0,0x60,0x65,0xc6,0x12,0xac,0xf1,0xec,0xa1,0x45,0xf1,0x0a,0x6c,0x80,
+    0x7b,0x82,0xc7,0xef,0xdf,0xe6,0xd5,0xe2,0x0b,0xc1,0x16,0x3d,0x04,0xc5,0x37,0x24,
+    0xa1,0x73,0x66,0x80,0xf3,0xb8,0x13,0x3d,0x73,0x66,0x62,0xba,0x80,0x3c,0x0f,0xac,
+    0x9d,0x71,0x03,0x84,0x91,0xe8,0x8d,0xac,0xb3,0xfb,0xbb,0x1f,0x0f,0xd9,0x91,0xbe,
+    0xce,0x32,0xa0,0x71,0x9e,0xad,0x3a,0x1b,0x26,0xcd,0xca,0xa2,0xe3,0x55,0xac,0xcf,
+    0x83,0xe5,0x18,0xaf,0x34,0xcb,0xd8,0xdc,0x1f,0x65,0xa9,0x56,0x29,0x5e,0x54,0xb3,
+    0x3c,0x90,0xa0,0xef,0xa2,0x65,0xc7,0x99,0xfb,0x13,0x3b,0xfa,0x39,0x29,0x47,0xf2,
+    0x44,0x74,0x92,0xe1,0x7c,0xd9,0xaa,0xf1,0xe2,0xff,0x7c,0x51,0xef,0x77,0xae,0xee,
+    0x08,0x88,0x77,0x16,0x64,0xc3,0xf8,0x46,0xe0,0x3f,0xcc,0xc9,0x8c,0x23,0xd6,0x4f,
+    0xed,0xa0,0x38,0x6b,0x1e,0xad,0x36,0x28,0xe1,0xd3,0x69,0x7a,0x53,0x55,0x28,0x9f,
+    0xfb,0x0b,0xab,0x6d,0x2a,0x3f,0xa0,0xd6,0xcd,0x43,0xd0,0x2c,0xbd,0x06,0xd8,0x2a,
+    0xad,0x03,0x75,0x6b,0x0c,0x03,0x76,0x4c,0x0e,0x10,0xfc,0x14,0x0e,0xf6,0xbe,0x9b,
+    0x34,0x4c,0x33,0xd7,0x32,0xb8,0x3c,0x03,0xab,0x95,0x8d,0x7c,0xc1,0xc7,0xf0,0x3b,
+    0x5b,0x1d,0x9c,0x8d,0xaf,0x73,0xf1,0x1b,0x92,0x04,0x28,0x8b,0xb4,0x03,0x00,0x00,
+};
+const StaticAssets::Asset StaticAssets::otaHtml = {
+    nullptr, "text/html", k_otaHtml, sizeof(k_otaHtml), "\"64f90d50\"", "64f90d50"
+};
+
+const StaticAssets::Asset* const StaticAssets::kRouted[] = {
+    &StaticAssets::bwiJs,
+    &StaticAssets::bwiCss,
+    &StaticAssets::statusJs,
+    &StaticAssets::statusCss
+};
+const size_t StaticAssets::kRoutedCount = sizeof(kRouted) / sizeof(kRouted[0]);
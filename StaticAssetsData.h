@@ -0,0 +1,16 @@
+// generated by tools/embed_assets.py from assets/ - do not edit
+// included by StaticAssets.h
+#pragma once
+
+namespace StaticAssets {
+  extern const Asset bwiJs;      // assets/bwi.js
+  extern const Asset bwiCss;     // assets/bwi.css
+  extern const Asset statusJs;   // assets/status.js
+  extern const Asset statusCss;  // assets/status.css
+  extern const Asset loginHtml;  // assets/login.html
+  extern const Asset otaHtml;    // assets/ota.html
+
+  /** assets with a URL, registered by setupRoutes() */
+  extern const Asset* const kRouted[];
+  extern const size_t kRoutedCount;
+}
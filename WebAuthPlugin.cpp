@@ -1,5 +1,6 @@
 // WebAuthPlugin.cpp
 #include "WebAuthPlugin.h"
+#include "StaticAssets.h"
 
 
 
@@ -29,28 +30,15 @@ String WebAuthPlugin::parseCookieToken_(WebServer& srv, const char* cookieName){
 void WebAuthPlugin::sendRedirect_(WebServer& srv, const String& to){
   srv.sendHeader("Location", to); srv.send(302, "text/plain", "Redirecting...");
 }
-String WebAuthPlugin::htmlLogin_(){
-  return "<!doctype html><meta name=viewport content='width=device-width, initial-scale=1'/>"
-         "<style>body{font-family:sans-serif;max-width:420px;margin:4em auto;padding:0 1em}"
-         "form{display:grid;gap:.6em}label{font-size:.9em}input{padding:.5em}"
-         "button{padding:.6em 1em}</style>"
-         "<h3>Login</h3>"
-         "<form method='POST' action='/login'>"
-         "<label>User<br/><input type='text' name='u' autofocus></label>"
-         "<label>Password<br/><input type='password' name='p'></label>"
-         "<input type='hidden' name='next' id='next'>"
-         "<button type='submit'>Login</button></form>"
-         "<script>const qp=new URLSearchParams(location.search);"
-         "document.getElementById('next').value=qp.get('next')||'/'</script>";
-}
-
 void WebAuthPlugin::install(WebServer& srv){
   if (installed_) return;
   server_ = &srv;
   installed_ = true;
 
-  static const char* headerKeys[] = { "Cookie" };
-  server_->collectHeaders(headerKeys, 1);
+  // WebServer keeps a single list; If-None-Match and Accept are for the
+  // conditional / CBOR display routes of BasicWebInterface
+  static const char* headerKeys[] = { "Cookie", "If-None-Match", "Accept" };
+  server_->collectHeaders(headerKeys, 3);
 
   // GET /login
   server_->on("/login", HTTP_GET, [this]{
@@ -62,7 +50,7 @@ void WebAuthPlugin::install(WebServer& srv){
       // the next logic is not working yet, so redirect to root for now - maybe fix in future
       sendRedirect_(*server_, "/"); return;
     }
-    server_->send(200, "text/html", htmlLogin_());
+    StaticAssets::send(*server_, StaticAssets::loginHtml, false);   // assets/login.html
   });
 
   // POST /login
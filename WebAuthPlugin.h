@@ -31,7 +31,6 @@ private:
                           std::initializer_list<const char*> extra) const;
   static String parseCookieToken_(WebServer& srv, const char* cookieName);
   static void sendRedirect_(WebServer& srv, const String& to);
-  static String htmlLogin_();
 
   AuthManager auth_;
   bool installed_ = false;
@@ -6,31 +6,22 @@
 
 String WebButton::createHtmlFragment() const
 {
+    // click handling (incl. the client-side cooldown) lives in /static/bwi.js
     String html;
-    html.reserve(256);
-    html += "<button id='";  html += id();  html += "_btn' "
-            "style='padding:6px 12px;margin:4px'>"
-            + jsonEscape(label_) + "</button>\n"
-            "<script>(function(){\n"
-            " const btn=document.getElementById('";  html += id();
-    html += "_btn');\n"
-            " let last=0;\n"
-            " btn.addEventListener('click', async()=>{\n"
-            "   const now=Date.now();\n";
-    if (cooldownMs_)
-        html += "   if(now-last<" + String(cooldownMs_) + ")return;\n";
-    html += "   last=now; btn.disabled=true;\n"
-            "   try{await fetch('";  html += handle();  html += "');}"
-            " catch(e){}\n";
-    if (cooldownMs_)
-        html += "   setTimeout(()=>btn.disabled=false,"+String(cooldownMs_)+");\n";
-    else
-        html += "   btn.disabled=false;\n";
-    html += " });})();</script>\n";
+    html.reserve(160);
+    html += "<button id='";  html += id();  html += "_btn' class='bwi-btn'"
+            " data-bwi='button' data-src='";  html += handle();
+    html += "' data-cooldown='";  html += String(cooldownMs_);
+    html += "'>";
+    {
+        StringChunkWriter w(html);
+        w.writeHtmlEscaped(label_);
+    }
+    html += "</button>\n";
     return html;
 }
-/** GET handler – fires callback & returns a JSON ack */
-String WebButton::routeText() const 
+/** GET handler – fires callback & writes a JSON ack */
+void WebButton::writeValue(JsonWriter& j) const
 {
     const uint32_t now = millis();
     if (onClick_ && now - lastClick_ >= cooldownMs_) {
@@ -43,6 +34,5 @@ String WebButton::routeText() const
             gLogger->println("WebButton: " + id() + " click blocked: not authenticated");
         }
     }
-    return "{\"id\":\"" + id() +
-           "\",\"clicks\":" + String(clickCounter_) + "}";
+    j.beginObject().member("id", id()).member("clicks", clickCounter_).endObject();
 }
\ No newline at end of file
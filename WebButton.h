@@ -37,11 +37,11 @@ public:
     /* WebDisplayBase interface                                              */
     /* --------------------------------------------------------------------- */
 
-    /** Button page fragment (HTML + inline JS) */
+    /** Button page fragment (markup bound by /static/bwi.js) */
     String createHtmlFragment() const override;
 
-    /** GET handler – fires callback & returns a JSON ack */
-    String routeText() const override;
+    /** GET handler – fires callback & writes a JSON ack */
+    void writeValue(JsonWriter& j) const override;
 
 private:
     String                     label_;
@@ -2,7 +2,14 @@
 #define WEBDISPLAY_H
 
 #include <Arduino.h>
+#include <esp_system.h>
 #include <LoggingBase.h> //DEBUG
+#include "DisplayHistory.h"
+#include "JsonWriter.h"
+#include "DisplayValueSlot.h"
+#include <atomic>
+#include <cmath>
+#include <type_traits>
 // -----------------------------------------------------------------------------
 //  Minimal base class
 // -----------------------------------------------------------------------------
@@ -16,8 +23,20 @@ public:
     /** HTML/JS snippet to embed in the client page */
     virtual String createHtmlFragment() const = 0;
 
-    /** Payload your HTTP handler returns (e.g. JSON) */
-    virtual String routeText() const = 0;
+    /** payload of the display route, /displays.json and /events, written
+        through 'j' so it serves JSON and CBOR alike. Override this (or, for
+        simple custom displays, routeText() – sent as a CBOR text string in
+        binary responses); each default is implemented by the other. */
+    virtual void writeValue(JsonWriter& j) const { j.raw(routeText().c_str()); }
+    virtual String routeText() const {
+        String json;
+        StringChunkWriter w(json);
+        writeJson(w);
+        w.flush();
+        return json;
+    }
+    void writeJson(ChunkedWriter& w) const { JsonWriter j(w); writeValue(j); }
+    void writeCbor(ChunkedWriter& w) const { JsonWriter j(w, JsonWriter::Format::Cbor); writeValue(j); }
 
     // helpers --------------------------------------------------------------
     const String & id() const { return id_; }
@@ -25,14 +44,79 @@ public:
     const String &idStr() const { return id_; }
     uint32_t updateInterval() const { return updateInterval_; }
 
+    /** bumped by update() whenever the value changes; displays that read their
+        value on demand (tracksChanges() == false) are re-sent on their interval */
+    uint32_t version() const { return version_.load(); }
+    /** version() for a cache validator: false while update() is between its
+        two stores, when the version says nothing about the value */
+    bool settledVersion(uint32_t& v) const {
+        v = version_.load();
+        return v != kChanging_;
+    }
+    virtual bool tracksChanges() const { return false; }
+
+    /** history attached with attachHistory() (nullptr: none) */
+    DisplayHistoryBase* history() const { return history_; }
+
+    /** versions come from one counter shared by all displays, so "anything
+        newer than N" works across displays; changeSeq() is the latest one */
+    static uint32_t changeSeq() { return changeSeq_().load(); }
+    /** random per boot: a version tag from before a reboot never matches */
+    static uint32_t bootTag() {
+        static const uint32_t tag = esp_random();
+        return tag;
+    }
+
 protected:
+    // may run in a sensor task: both counters are atomic. version_ goes to
+    // kChanging_ before the shared counter moves on: a poll that already sees
+    // the new changeSeq() must not find the old version here, or it skips the
+    // display and every later "newer than" poll does as well
+    void markChanged() {
+        version_.store(kChanging_);
+        version_.store(changeSeq_().fetch_add(1) + 1);
+    }
+    static constexpr uint32_t kChanging_ = UINT32_MAX;   // newer than any 'since'
+
+    /* Marks the fragment's root element for the shared runtime (WebRuntime,
+       /static/bwi.js): ' data-bwi="<kind>" data-id="<id>" data-iv="<ms>"'.
+       The runtime binds it by kind and feeds it from the shared poller. */
+    void appendBindAttrs(String& html, const char* kind) const {
+        html += F(" data-bwi=\"");  html += kind;
+        html += F("\" data-id=\"");  html += id_;
+        html += F("\" data-iv=\"");  html += String(updateInterval_ * 1000);
+        html += '"';
+    }
+
+    /* For custom fragments that bring their own script: starts client-side
+       updates. If the page provides the shared poller (BasicWebInterface, one
+       /displays.json request per tick) the widget subscribes to it; otherwise
+       it polls its own route. */
+    void appendPollStart(String& html, const char* applyFn, const char* pollFn) const {
+        const String ms(updateInterval_ * 1000);
+        html += F("  if(window.bwiRegister) bwiRegister('");
+        html += id_;  html += "',";  html += ms;  html += ',';  html += applyFn;
+        html += F(");\n  else{ ");
+        html += pollFn;  html += F("(); setInterval(");  html += pollFn;  html += ',';  html += ms;
+        html += F("); }\n");
+    }
+
     String id_;
     String path_;
     uint32_t updateInterval_;
+    std::atomic<uint32_t> version_{0};
+    DisplayHistoryBase* history_ = nullptr;
+
+private:
+    static std::atomic<uint32_t>& changeSeq_() {
+        static std::atomic<uint32_t> seq{0};
+        return seq;
+    }
 };
 
 // -----------------------------------------------------------------------------
-//  Utilities – tiny JSON escaping and type-agnostic helpers
+//  Utilities – the built-in displays write through JsonWriter/JsonTraits;
+//  jsonEscape() stays for code that still builds JSON in Strings
 // -----------------------------------------------------------------------------
 inline String jsonEscape(const String &in) {
     String out;
@@ -51,66 +135,161 @@ inline String jsonEscape(const String &in) {
     return out;
 }
 
-// Generic fallback – numeric types and everything convertible to Arduino String
+// Sample fed into an attached DisplayHistory; NaN (ignored) for non-numeric types
+template <typename U, typename Enable = void>
+struct _HistorySample {
+    static float value(const U &) { return NAN; }
+};
 template <typename U>
-struct _JsonHelper {
-    static String encode(const U &v) { return String(v); }          // -> "42"
-    static String dom  (const U &v) { return String(v); }          // -> 42
+struct _HistorySample<U, typename std::enable_if<std::is_arithmetic<U>::value>::type> {
+    static float value(const U &v) { return static_cast<float>(v); }
 };
-// Specialisation for Arduino String (quoted in JSON, not in DOM)
-template <>
-struct _JsonHelper<String> {
-    static String encode(const String &v) { return String('"') + jsonEscape(v) + '"'; }
-    static String dom  (const String &v) { return v; }
+
+// -----------------------------------------------------------------------------
+//  Update filtering – which update() calls reach the page
+// -----------------------------------------------------------------------------
+struct UpdateFilter {
+    UpdateFilter(float deadband = 0, float relDeadband = 0, uint32_t minIntervalMs = 0)
+        : deadband(deadband), relDeadband(relDeadband), minIntervalMs(minIntervalMs) {}
+
+    float    deadband;        // publish once |new - published| exceeds this
+    float    relDeadband;     //   or this fraction of |published| (the wider band applies)
+    uint32_t minIntervalMs;   // and no sooner than this after the previous publish
+
+    /** false: no band, every change is published */
+    bool banded() const { return deadband > 0 || relDeadband > 0; }
+};
+
+// Significant change under a filter. Without a band any difference counts,
+// compared in U itself; non-numeric types (String, bool, ...) always do that
+template <typename U, typename Enable = void>
+struct _DeadbandHelper {
+    static bool exceeds(const U &published, const U &v, const UpdateFilter &) {
+        return !(published == v);
+    }
+};
+// floating point: band compared in double; NaN -> NaN is no change, any
+// other step to or from NaN / inf is
+template <typename U>
+struct _DeadbandHelper<U, typename std::enable_if<std::is_floating_point<U>::value>::type> {
+    static bool exceeds(const U &published, const U &v, const UpdateFilter &f) {
+        if (!f.banded() || !std::isfinite(published) || !std::isfinite(v)) {
+            return !(published == v) && !(std::isnan(published) && std::isnan(v));
+        }
+        const double p    = published;
+        const double rel  = f.relDeadband * std::fabs(p);
+        const double band = rel > f.deadband ? rel : f.deadband;
+        return std::fabs(static_cast<double>(v) - p) > band;
+    }
+};
+// integers: the distance is taken in the unsigned type, exact at any size
+template <typename U>
+struct _DeadbandHelper<U, typename std::enable_if<std::is_integral<U>::value
+                                                  && !std::is_same<U, bool>::value>::type> {
+    static bool exceeds(const U &published, const U &v, const UpdateFilter &f) {
+        if (published == v) return false;
+        if (!f.banded())    return true;
+        typedef typename std::make_unsigned<U>::type Unsigned;
+        const Unsigned dist = v > published ? Unsigned(Unsigned(v) - Unsigned(published))
+                                            : Unsigned(Unsigned(published) - Unsigned(v));
+        const double rel  = f.relDeadband * std::fabs(static_cast<double>(published));
+        const double band = rel > f.deadband ? rel : f.deadband;
+        return static_cast<double>(dist) > band;
+    }
+};
+
+/* Value slot behind an UpdateFilter. The published value only moves when a
+   sample leaves the deadband around it (hysteresis: small wobble never gets
+   through, however long it lasts). A significant change inside minIntervalMs
+   is held back and the newest sample goes out with the first update() after
+   the interval. Writer-side calls (update, publishNow, latest) belong to the
+   updating task, load() to the web task – see DisplayValueSlot. */
+template <typename T>
+class FilteredValueSlot {
+public:
+    FilteredValueSlot(const T &initial, const UpdateFilter &filter)
+        : slot_(initial), latest_(initial), filter_(filter) {}
+
+    /** true if v (or the held-back latest sample) was published */
+    bool update(const T &v, uint32_t nowMs) {
+        latest_ = v;
+        if (!pending_ && !_DeadbandHelper<T>::exceeds(slot_.last(), v, filter_)) return false;
+        if (published_ && nowMs - lastPublishMs_ < filter_.minIntervalMs) {
+            pending_ = true;
+            return false;
+        }
+        return publishNow(nowMs);
+    }
+
+    /** publishes latest() regardless of the filter */
+    bool publishNow(uint32_t nowMs) {
+        pending_ = false;
+        if (!slot_.store(latest_)) return false;
+        lastPublishMs_ = nowMs;
+        published_     = true;
+        return true;
+    }
+
+    const T &latest() const { return latest_; }
+    const T &load() const   { return slot_.load(); }
+
+private:
+    DisplayValueSlot<T> slot_;
+    T                   latest_;
+    UpdateFilter        filter_;
+    uint32_t            lastPublishMs_ = 0;
+    bool                published_     = false;
+    bool                pending_       = false;
 };
 
 // -----------------------------------------------------------------------------
-//  Concrete templated display – stores any value convertible to String
+//  Concrete templated display – stores any value JsonTraits<T> can write
 // -----------------------------------------------------------------------------
 template <typename T>
 class WebDisplay : public WebDisplayBase {
 public:
-    WebDisplay(const String &id, uint32_t updateIntervalSecs, const T &initial = T())
-        : WebDisplayBase(id, updateIntervalSecs), value_(initial) {}
+    /** 'filter' holds back insignificant changes (deadband / minimum interval) */
+    WebDisplay(const String &id, uint32_t updateIntervalSecs, const T &initial = T(),
+               const UpdateFilter &filter = UpdateFilter())
+        : WebDisplayBase(id, updateIntervalSecs), value_(initial, filter) {}
 
     // Firmware code calls this to push new data
-    void update(const T &v) { value_ = v; }
+    void update(const T &v) {
+        const uint32_t now = millis();
+        if (history_) history_->add(_HistorySample<T>::value(v), now);
+        if (value_.update(v, now)) markChanged();
+    }
+    /** last value passed to update(), published or not (updating task only) */
+    const T &latest() const { return value_.latest(); }
+    /** publishes latest() now, bypassing the filter */
+    void publishLatest() { if (value_.publishNow(millis())) markChanged(); }
+    bool tracksChanges() const override { return true; }
+
+    /** keeps a min/max/avg history of every update() (numeric T only);
+        'h' must outlive the display */
+    void attachHistory(DisplayHistoryBase &h) { history_ = &h; }
 
     // ------------------------------------------------------ WebDisplayBase ----
-    String routeText() const override {
-        String json;
-        json.reserve(id_.length() + 32);
-        json += F("{\"id\":\"");
-        json += id();
-        json += F("\",\"value\":");
-        json += _JsonHelper<T>::encode(value_);
-        json += '}';
-        return json;
+    void writeValue(JsonWriter &j) const override {
+        j.beginObject().member("id", id_).member("value", value_.load()).endObject();
     }
 
     String createHtmlFragment() const override {
         String html;
-        html.reserve(200);
-        html += "<span id=\"";  html += id_;  html += "\">";
-        html += _JsonHelper<T>::dom(value_);
-        html += "</span>\n<script>\n(function(){\n  const el=document.getElementById('"; 
-        html += id(); 
-        html += "');\n  async function poll(){\n    try{const r=await fetch('"; 
-        html += handle(); 
-        html += "');\n        if(r.ok){const d=await r.json(); el.textContent=d.value;}}catch(e){}\n  }\n  poll();\n  setInterval(poll,"; 
-        html += String(updateInterval_ * 1000); html += ");\n})();\n</script>\n";
+        html.reserve(80);
+        html += "<span id=\"";  html += id_;  html += '"';
+        appendBindAttrs(html, "text");
+        html += '>';
+        {
+            StringChunkWriter w(html);
+            JsonTraits<T>::writeText(w, value_.load());
+        }
+        html += "</span>\n";
         return html;
     }
 
 private:
-    T value_;
-};
-
-// ---- Add this next to your helpers -----------------------------------------
-template <>
-struct _JsonHelper<bool> {
-    static String encode(const bool &v) { return v ? F("true") : F("false"); }
-    static String dom   (const bool &v) { return v ? F("true") : F("false"); } // not used by the bool UI
+    FilteredValueSlot<T> value_;
 };
 
 // ---- WebDisplay<bool> specialization ---------------------------------------
@@ -120,77 +299,37 @@ public:
     WebDisplay(const String &id, uint32_t updateIntervalSecs, const bool &initial = false)
     : WebDisplayBase(id, updateIntervalSecs), value_(initial) {}
 
-    void update(const bool &v) { value_ = v; }
+    void update(const bool &v) {
+        if (value_.store(v)) markChanged();
+    }
+    bool tracksChanges() const override { return true; }
 
-    String routeText() const override {
-        String json;
-        json.reserve(id_.length() + 32);
-        json += F("{\"id\":\"");
-        json += id();
-        json += F("\",\"value\":");
-        json += _JsonHelper<bool>::encode(value_);
-        json += '}';
-        return json;
+    void writeValue(JsonWriter &j) const override {
+        j.beginObject().member("id", id_).member("value", value_.load()).endObject();
     }
 
     String createHtmlFragment() const override {
         String html;
-        html.reserve(700);
-
-        // Namespacing prefix to isolate styles per instance
-        const String p = "wd-" + id();
-
-        // Initial classes
-        const char* redCls   = value_ ? "off"      : "on red";
-        const char* greenCls = value_ ? "on green" : "off";
-
-        // Inline, namespaced CSS (safe to repeat; unique per id)
-        html += "<style>"
-                "." + p + " .led{width:12px;height:12px;border-radius:50%;display:inline-block;"
-                          "margin:0 4px 0 0;background:#bfbfbf;vertical-align:middle;"
-                          "box-shadow:inset 0 0 2px rgba(0,0,0,.5)}"
-                "." + p + " .on.red{background:#d63c3c}"
-                "." + p + " .on.green{background:#2bb24c}"
-                "." + p + " .off{background:#bfbfbf}"
-                "." + p + " .wrap{display:inline-flex;align-items:center;gap:6px}"
-                "." + p + " .lbl{font:12px/1.2 sans-serif;opacity:.85}"
-                "</style>";
-
-        // HTML
-        html += "<div id=\""; html += id(); html += "_wrap\" class=\"";
-        html += p; html += " wrap\" role=\"group\" aria-label=\""; html += id(); html += "\">";
-        html +=   "<span id=\""; html += id(); html += "_r\" class=\"led "; html += redCls;   html += "\" aria-label=\"red\"></span>";
-        html +=   "<span id=\""; html += id(); html += "_g\" class=\"led "; html += greenCls; html += "\" aria-label=\"green\"></span>";
+        html.reserve(240);
+
+        // red/green LED pair, styled by .bwi-led in /static/bwi.css
+        const bool on = value_.load();
+        const char* redCls   = on ? "off"      : "on red";
+        const char* greenCls = on ? "on green" : "off";
+
+        html += "<div id=\""; html += id(); html += "_wrap\" class=\"bwi-led\" role=\"group\" aria-label=\"";
+        html += id(); html += '"';
+        appendBindAttrs(html, "led");
+        html += '>';
+        html +=   "<span class=\"led "; html += redCls;   html += "\" aria-label=\"red\"></span>";
+        html +=   "<span class=\"led "; html += greenCls; html += "\" aria-label=\"green\"></span>";
         html +=   "<span class=\"lbl\">"; html += id(); html += "</span>";
         html += "</div>\n";
-
-        // Polling script: fetch JSON {value: true|false} and toggle classes
-        html += "<script>\n"
-                "(function(){\n"
-                "  const id='" + id() + "';\n"
-                "  const r=document.getElementById(id+'_r');\n"
-                "  const g=document.getElementById(id+'_g');\n"
-                "  function apply(v){\n"
-                "    if(v){ r.className='led off'; g.className='led on green'; }\n"
-                "    else { r.className='led on red'; g.className='led off'; }\n"
-                "  }\n"
-                "  async function poll(){\n"
-                "    try{\n"
-                "      const resp=await fetch('" + handle() + "');\n"
-                "      if(resp.ok){ const d=await resp.json(); apply(!!d.value); }\n"
-                "    }catch(e){}\n"
-                "  }\n"
-                "  apply(" + String(value_ ? "true" : "false") + ");\n"
-                "  poll();\n"
-                "  setInterval(poll," + String(updateInterval_ * 1000) + ");\n"
-                "})();\n"
-                "</script>\n";
-
         return html;
     }
 
 private:
-    bool value_{false};
+    DisplayValueSlot<bool> value_;
 };
 
 
@@ -203,78 +342,57 @@ public:
     WebBarDisplay(const String &id,
                   uint32_t      updateIntervalSecs,
                   const T      &maxVal = 100,
-                  const String unit = "%")
-        : WebDisplayBase(id, updateIntervalSecs), value_(), maxVal_(maxVal), unit_(unit) {}
+                  const String unit = "%",
+                  const UpdateFilter &filter = UpdateFilter())
+        : WebDisplayBase(id, updateIntervalSecs), value_(T(), filter), maxVal_(maxVal), unit_(unit) {}
 
     /* push a new percentage (0‒100) from firmware code */
-    void update(const T &v) { value_ = v; }
+    void update(const T &v) {
+        const uint32_t now = millis();
+        if (history_) history_->add(_HistorySample<T>::value(v), now);
+        if (value_.update(v, now)) markChanged();
+    }
+    const T &latest() const { return value_.latest(); }
+    void publishLatest() { if (value_.publishNow(millis())) markChanged(); }
+    /* like update(): from the updating task, the page reads it on the web task */
     void setMaxVal(const T &maxVal) {
-        maxVal_ = maxVal;
+        maxVal_.store(maxVal);
     }
+    bool tracksChanges() const override { return true; }
+    void attachHistory(DisplayHistoryBase &h) { history_ = &h; }
 
     // -------------------------- WebDisplayBase overrides -----------------------
-    String routeText() const override {
-
-        String json;
-        json.reserve(id_.length() + 24);
-        json += F("{\"id\":\"");
-        json += id();
-        json += F("\",\"value\":");
-        json += String(value_);
-        json += '}';
-        return json;
+    void writeValue(JsonWriter &j) const override {
+        j.beginObject().member("id", id_).member("value", value_.load()).endObject();
     }
 
     String createHtmlFragment() const override {
         String html;
-        html.reserve(400);
-
-        // ---------- static HTML ---------------------------------------------
-        const float pctInit = (maxVal_ > 0) ? (value_ * 100.0f / maxVal_) : 0;
-
-        html += "<div id=\""; html += id(); html += "_container\" "
-                "style=\"position:relative;width:100%;height:24px;"
-                "background:#ddd;border-radius:4px;overflow:hidden;\">\n";
-
-        html += "  <div id=\""; html += id(); html += "_bar\" "
-                "style=\"height:100%;width:";
-        html += String(pctInit);
-        html += "%;background:#4caf50;color:#fff;text-align:center;"
-                "line-height:24px;font-size:12px;\">";
-        html += String(value_);
-        html += unit_;
-        html += "</div></div>\n";
-
-        // ---------- polling script ------------------------------------------
-        html += "<script>\n"
-                "(function(){\n"
-                " const bar=document.getElementById('";  html += id(); html += "_bar');\n"
-                " const max=";  html += String(maxVal_); html += ";\n"
-                " const unit='"; html += unit_;         html += "';\n"
-                " async function poll(){\n"
-                "   try{\n"
-                "     const r=await fetch('"; html += handle(); html += "');\n"
-                "     if(r.ok){\n"
-                "       const d=await r.json();\n"
-                "       const v=parseFloat(d.value);\n"
-                "       const pct=Math.min(100, Math.max(0,(v/max)*100));\n"
-                "       bar.style.width=pct+'%';\n"
-                "       bar.textContent=v.toFixed(1)+unit;\n"
-                "     }\n"
-                "   }catch(e){}\n"
-                " }\n"
-                " poll();\n"
-                " setInterval(poll,"; html += String(updateInterval_ * 1000); html += ");\n"
-                "})();\n"
-                "</script>\n";
+        html.reserve(200);
 
+        const T value  = value_.load();
+        const T maxVal = maxVal_.load();
+        const float pctInit = (maxVal > 0) ? (value * 100.0f / maxVal) : 0;
+
+        html += "<div id=\""; html += id(); html += "_container\" class=\"bwi-bar\">";
+        html += "<div id=\""; html += id(); html += "_bar\"";
+        appendBindAttrs(html, "bar");
+        {
+            StringChunkWriter w(html);
+            w.write(F(" data-max=\""));     JsonTraits<T>::writeText(w, maxVal);
+            w.write(F("\" data-unit=\""));  w.writeHtmlEscaped(unit_);
+            w.write(F("\" style=\"width:")); w.writeFloat(pctInit, 2);
+            w.write(F("%\">"));              JsonTraits<T>::writeText(w, value);
+            w.writeHtmlEscaped(unit_);
+            w.write(F("</div></div>\n"));
+        }
         return html;
     }
 
 private:
+    FilteredValueSlot<T> value_;
+    DisplayValueSlot<T>  maxVal_;
     String unit_; // e.g. "%", "L", etc.
-    T value_;
-    T maxVal_;
 };
 
 #endif // WEBDISPLAY_H
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include <Arduino.h>
+#include "ChunkedWriter.h"
 class WebServer;
 
 // base class for web items (displays, settings blocks, buttons, etc) that defines the setupRoutes(server) and the generateHTML
@@ -7,4 +8,6 @@ class WebItem {
 public:
     virtual void setupRoutes(WebServer& server) = 0;
     virtual String generateHTML() const = 0;
+    // streaming counterpart used for the root page; override for large items
+    virtual void writeHTML(ChunkedWriter& w) const { w.write(generateHTML()); }
 };
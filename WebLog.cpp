@@ -8,10 +8,12 @@ void WebLog::addToLog(String message, bool newTimeStamp){
     if(!turnedOn){
         return;
     }
+    const uint32_t version = version_.fetch_add(1, std::memory_order_relaxed) + 1;
 
     if(! newTimeStamp){//append to the last entry
         if(logMessages.size() > 0){
             logMessages.back() += message;
+            logChanged.back() = version;
             if(mirrorToSerial)
                 Serial.print(message);
             return;
@@ -22,6 +24,8 @@ void WebLog::addToLog(String message, bool newTimeStamp){
     if(logMessages.size() >= logSize){
         logMessages.erase(logMessages.begin());
         logTimestamps.erase(logTimestamps.begin());
+        logChanged.erase(logChanged.begin());
+        ++firstSeq;
     }
     uint32_t timestamp = 0;
     if(gTimeProvider){
@@ -29,6 +33,7 @@ void WebLog::addToLog(String message, bool newTimeStamp){
     }
     logMessages.push_back(message);
     logTimestamps.push_back(timestamp);
+    logChanged.push_back(version);
     
     if(mirrorToSerial){
         Serial.println(message);
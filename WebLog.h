@@ -30,6 +30,7 @@ public:
         logSize = size;  
         logMessages.reserve(logSize);
         logTimestamps.reserve(logSize);
+        logChanged.reserve(logSize);
         xSemaphoreGive(accessMutex);
     }
 
@@ -68,6 +69,29 @@ public:
         return sz;
     }
 
+    struct Entry {
+        uint32_t seq;         // counts every entry ever added
+        uint32_t timestamp;
+        String   message;
+    };
+    // entries changed after version 'since', oldest first: the ones added
+    // since and the last one if print() extended it (every entry for a
+    // reader that fell a whole ring behind). 'oldestSeq' is the seq of the
+    // oldest entry still held.
+    std::vector<Entry> getLogEntriesSince(uint32_t since, uint32_t& oldestSeq){
+        xSemaphoreTake(accessMutex, portMAX_DELAY);
+        oldestSeq = firstSeq;
+        size_t from = logChanged.size();   // ascending: changes go to the end
+        while (from > 0 && logChanged[from - 1] > since) --from;
+        std::vector<Entry> entries;
+        entries.reserve(logMessages.size() - from);
+        for (size_t i = from; i < logMessages.size(); ++i) {
+            entries.push_back(Entry{firstSeq + (uint32_t)i, logTimestamps[i], logMessages[i]});
+        }
+        xSemaphoreGive(accessMutex);
+        return entries;
+    }
+
     std::vector<std::pair<uint32_t, String>> getLogEntries() {
         xSemaphoreTake(accessMutex, portMAX_DELAY);
         std::vector<std::pair<uint32_t, String>> entries;
@@ -86,6 +110,9 @@ public:
         xSemaphoreGive(accessMutex);
         return sz;
     }
+    // bumped by every print / println that reaches the log
+    uint32_t version() const { return version_.load(std::memory_order_relaxed); }
+
     std::atomic<bool> mirrorToSerial{false};
     std::atomic<bool> turnedOn{true};
     void turnOn(){turnedOn = true;}
@@ -100,8 +127,11 @@ private:
 
     std::vector<String> logMessages;
     std::vector<uint32_t> logTimestamps;
+    std::vector<uint32_t> logChanged;   // version of each entry's last change
+    uint32_t firstSeq{0};               // seq of logMessages[0]
     uint8_t logSize;
     bool nextEntryNewTimeStamp{true}; //for the next entry
+    std::atomic<uint32_t> version_{0};
 };
 
 extern WebLog webLog; //global instance
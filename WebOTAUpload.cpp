@@ -1,4 +1,6 @@
 #include "WebOTAUpload.h"
+#include "SettingsSaveQueue.h"
+#include "StaticAssets.h"
 
 WebOTAUpload::WebOTAUpload(const String& password, const String& route)
     : route_(route),
@@ -15,7 +17,7 @@ void WebOTAUpload::setupRoutes(WebServer& server) {
 
     // GET: show upload page
     server.on(route_.c_str(), HTTP_GET, [this]() {
-        server_->send(200, "text/html", buildPage_());
+        StaticAssets::send(*server_, StaticAssets::otaHtml, false);   // assets/ota.html
     });
 
     // POST: finalize (called after all chunks processed)
@@ -42,7 +44,10 @@ void WebOTAUpload::setupRoutes(WebServer& server) {
                           ok ? "Update Success. Rebooting..." : "Update Failed!");
             gLogger->println(ok ? F("[OTA] Update success") : F("[OTA] Update failed"));
             delay(200);
-            if (ok) ESP.restart();
+            if (ok) {
+                SettingsSaveQueue::instance().flush();   // don't lose queued settings
+                ESP.restart();
+            }
 
             // Reset state for next cycle
             uploadStarted_ = false;
@@ -73,6 +78,9 @@ void WebOTAUpload::setupRoutes(WebServer& server) {
                     gLogger->print(F("[OTA] Start: "));
                     gLogger->println(up.filename);
 
+                    // persist queued settings before flash writes take over
+                    SettingsSaveQueue::instance().flush();
+
                     if (!Update.begin(UPDATE_SIZE_UNKNOWN)) {
                         gLogger->println(Update.errorString());
                         break;
@@ -137,35 +145,3 @@ void WebOTAUpload::markAppValid() {
     gLogger->println(err == ESP_OK ? F("[OTA] Marked app valid (cancelled rollback).")
                                    : F("[OTA] Failed to mark app valid!"));
 }
-
-String WebOTAUpload::buildPage_() const {
-    // Minimalistic, no JS required; password field is mandatory.
-    String s;
-    s.reserve(1200);
-    s = F(
-        "<!doctype html><html><head><meta charset='utf-8'>"
-        "<meta name='viewport' content='width=device-width,initial-scale=1'>"
-        "<title>OTA Update</title>"
-        "<style>"
-        "body{font-family:sans-serif;max-width:680px;margin:2rem auto;padding:0 1rem}"
-        "h1{font-size:1.6rem}"
-        ".box{border:1px solid #ccc;padding:1rem;border-radius:.5rem}"
-        "label{display:block;margin:.5rem 0 .25rem}"
-        "input[type=password],input[type=file]{width:100%}"
-        "button{margin-top:1rem}"
-        "</style></head><body>"
-        "<h1>Firmware OTA</h1>"
-        "<div class='box'>"
-        "<form method='POST' action='");
-    s += route_;
-    s += F("' enctype='multipart/form-data'>"
-           "<label>Password</label>"
-           "<input type='password' name='password' required>"
-           "<label>Firmware (.bin)</label>"
-           "<input type='file' name='firmware' accept='.bin' required>"
-           "<button type='submit'>Upload & Update</button>"
-           "</form>"
-           "<p><small>The device will reboot after a successful update.</small></p>"
-           "</div></body></html>");
-    return s;
-}
\ No newline at end of file
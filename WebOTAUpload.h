@@ -34,6 +34,4 @@ private:
     String route_;
     OTAPasswordValidator validator_;
     bool uploadStarted_ = false;
-
-    String buildPage_() const;
 };
\ No newline at end of file
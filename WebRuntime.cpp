@@ -0,0 +1,25 @@
+#include "WebRuntime.h"
+#include "StaticAssets.h"
+#include "ChunkedWriter.h"
+
+// Shared client poller: widgets call bwiRegister(id, intervalMs, apply) and
+// one fetch of /displays.json per tick (at the shortest interval) feeds them all.
+// Each answer's X-Display-Seq goes back as ?since=, so unchanged displays are
+// not re-sent.
+// With data-sse on the script tag, /events pushes the same objects and the
+// polling pauses while the stream is open.
+// On DOMContentLoaded every [data-bwi] element is bound by its kind.
+// Sources: assets/bwi.js and assets/bwi.css (see StaticAssets.h).
+
+String WebRuntime::headTags(bool sse) {
+    String html;
+    html.reserve(120);
+    StringChunkWriter w(html);
+    w.write(F("<link rel='stylesheet' href='"));
+    StaticAssets::writeVersionedUrl(w, StaticAssets::bwiCss);
+    w.write(F("'>\n<script src='"));
+    StaticAssets::writeVersionedUrl(w, StaticAssets::bwiJs);
+    w.write(sse ? F("' data-sse='1'></script>\n") : F("'></script>\n"));
+    w.flush();
+    return html;
+}
@@ -0,0 +1,18 @@
+// -----------------------------------------------------------------------------
+// WebRuntime.h  – shared client script + stylesheet for the display widgets
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+
+
+/**
+ * The widgets only emit markup with data- attributes (see
+ * WebDisplayBase::appendBindAttrs); /static/bwi.js binds them to the shared
+ * poller and /static/bwi.css styles them. Both are pre-gzipped static assets
+ * (StaticAssets.h) served with a year-long immutable Cache-Control – the URLs
+ * carry a hash of the content, so a firmware update still reaches the browser.
+ */
+namespace WebRuntime {
+  /** <link>/<script> tags for the page; 'sse' lets the runtime use /events */
+  String headTags(bool sse);
+}
@@ -1,2 +1,193 @@
 #include "WebSettings.h"
-String SettingsBlockBase::kSettingsPassword =  "admin";  // default password
\ No newline at end of file
+#include <algorithm>
+String SettingsBlockBase::kSettingsPassword =  "admin";  // default password
+
+//----------------------------------------------------------------------------
+// SettingsArgs
+//----------------------------------------------------------------------------
+void SettingsArgs::collect(WebServer& srv) {
+    const int n = srv.args();
+    args_.clear();
+    jsonKeys_.clear();
+    args_.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        args_.emplace_back(srv.argName(i), srv.arg(i));
+    }
+    partial_ = false;
+    sort_();
+}
+
+void SettingsArgs::sort_() {
+    // stable: for repeated names the first occurrence wins, like WebServer::arg()
+    std::stable_sort(args_.begin(), args_.end(),
+        [](const std::pair<String, String>& a, const std::pair<String, String>& b) {
+            return strcmp(a.first.c_str(), b.first.c_str()) < 0;
+        });
+}
+
+const String* SettingsArgs::find(const char* key, int index) const {
+    char name[64];
+    if (index >= 0) {
+        snprintf(name, sizeof(name), "%s%s_%d", scope_, key, index);
+        key = name;
+    } else if (*scope_) {
+        snprintf(name, sizeof(name), "%s%s", scope_, key);
+        key = name;
+    }
+    auto it = std::lower_bound(args_.begin(), args_.end(), key,
+        [](const std::pair<String, String>& a, const char* k) {
+            return strcmp(a.first.c_str(), k) < 0;
+        });
+    if (it == args_.end() || strcmp(it->first.c_str(), key) != 0) return nullptr;
+    return &it->second;
+}
+
+//----------------------------------------------------------------------------
+// Flat JSON object -> SettingsArgs
+//   {"key": "str" | 1.5 | true | null | [scalar, ...], ...}
+// Nested objects are rejected; null values are skipped.
+//----------------------------------------------------------------------------
+namespace {
+
+struct JsonCursor {
+    const char* p;
+
+    void ws() { while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r') ++p; }
+    bool consume(char c) { ws(); if (*p != c) return false; ++p; return true; }
+
+    static void appendUtf8_(String& out, uint32_t cp) {
+        char b[4];
+        size_t n;
+        if      (cp < 0x80)    { b[0] = (char)cp; n = 1; }
+        else if (cp < 0x800)   { b[0] = (char)(0xC0 | (cp >> 6));  b[1] = (char)(0x80 | (cp & 0x3F)); n = 2; }
+        else if (cp < 0x10000) { b[0] = (char)(0xE0 | (cp >> 12)); b[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+                                 b[2] = (char)(0x80 | (cp & 0x3F)); n = 3; }
+        else                   { b[0] = (char)(0xF0 | (cp >> 18)); b[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+                                 b[2] = (char)(0x80 | ((cp >> 6) & 0x3F)); b[3] = (char)(0x80 | (cp & 0x3F)); n = 4; }
+        out.concat(b, n);
+    }
+
+    bool hex4_(uint32_t& cp) {
+        cp = 0;
+        for (int i = 0; i < 4; ++i, ++p) {
+            const char c = *p;
+            cp <<= 4;
+            if      (c >= '0' && c <= '9') cp |= (uint32_t)(c - '0');
+            else if (c >= 'a' && c <= 'f') cp |= (uint32_t)(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') cp |= (uint32_t)(c - 'A' + 10);
+            else return false;
+        }
+        return true;
+    }
+
+    bool string(String& out) {
+        if (!consume('"')) return false;
+        out = String();
+        const char* run = p;
+        while (*p != '"') {
+            if (*p == '\0' || (unsigned char)*p < 0x20) return false;
+            if (*p != '\\') { ++p; continue; }
+            out.concat(run, (unsigned)(p - run));
+            ++p;
+            const char e = *p++;
+            switch (e) {
+                case '"': case '\\': case '/': out += e; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u': {
+                    uint32_t cp;
+                    if (!hex4_(cp)) return false;
+                    if (cp >= 0xD800 && cp < 0xDC00 && p[0] == '\\' && p[1] == 'u') {
+                        const char* save = p;
+                        p += 2;
+                        uint32_t lo;
+                        if (hex4_(lo) && lo >= 0xDC00 && lo < 0xE000) cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                        else p = save;
+                    }
+                    appendUtf8_(out, cp);
+                    break;
+                }
+                default: return false;
+            }
+            run = p;
+        }
+        out.concat(run, (unsigned)(p - run));
+        ++p;
+        return true;
+    }
+
+    bool literal_(const char* word) {
+        const size_t n = strlen(word);
+        if (strncmp(p, word, n) != 0) return false;
+        p += n;
+        return true;
+    }
+
+    /* scalar as the text a form field would carry; isNull for null */
+    bool scalar(String& out, bool& isNull) {
+        ws();
+        isNull = false;
+        if (*p == '"')        return string(out);
+        if (literal_("true"))  { out = "1"; return true; }
+        if (literal_("false")) { out = "0"; return true; }
+        if (literal_("null"))  { isNull = true; return true; }
+        const char* start = p;
+        while ((*p >= '0' && *p <= '9') || *p == '-' || *p == '+' || *p == '.' || *p == 'e' || *p == 'E') ++p;
+        if (p == start) return false;
+        out = String();
+        out.concat(start, (unsigned)(p - start));
+        return true;
+    }
+};
+
+} // namespace
+
+bool SettingsArgs::parseJson(const String& body, const char** error) {
+    const char* err = nullptr;
+    JsonCursor c{ body.c_str() };
+    String key, val;
+    bool isNull;
+
+    args_.clear();
+    jsonKeys_.clear();
+    partial_ = true;
+
+    if (!c.consume('{')) err = "expected object";
+    else if (!c.consume('}')) {
+        do {
+            if (!c.string(key) || !c.consume(':')) { err = "expected key"; break; }
+            jsonKeys_.push_back(key);
+            c.ws();
+            if (*c.p == '{') { err = "nested objects are not supported"; break; }
+            if (c.consume('[')) {
+                if (c.consume(']')) continue;
+                char name[48];
+                int i = 0;
+                do {
+                    if (!c.scalar(val, isNull)) { err = "bad array element"; break; }
+                    snprintf(name, sizeof(name), "%s_%d", key.c_str(), i++);
+                    if (!isNull) args_.emplace_back(String(name), val);
+                } while (c.consume(','));
+                if (err) break;
+                if (!c.consume(']')) { err = "expected ]"; break; }
+            } else {
+                if (!c.scalar(val, isNull)) { err = "bad value"; break; }
+                if (!isNull) args_.emplace_back(key, val);
+            }
+        } while (c.consume(','));
+        if (!err && !c.consume('}')) err = "expected }";
+    }
+    if (!err) { c.ws(); if (*c.p) err = "trailing data"; }
+
+    if (err) {
+        args_.clear();
+        jsonKeys_.clear();
+        if (error) *error = err;
+        return false;
+    }
+    sort_();
+    return true;
+}
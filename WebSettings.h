@@ -13,16 +13,72 @@
 #include <Preferences.h>
 #include <WebServer.h>
 #include <vector>
+#include <functional>
 #include <type_traits>
 #include <LoggingBase.h>
 #include "WebAuthPlugin.h"
 #include "MACAddress.h" // TCPMessenger dependency here, but header only
+#include "ChunkedWriter.h"
+#include "JsonWriter.h"
+#include "NumberFormat.h"
+#include "SettingsSaveQueue.h"
 #include <cstdio>
+#include <cmath>
+
+
+/*------------------------------------------------------------*/
+/* 1.  POST argument index                                    */
+/*------------------------------------------------------------*/
+/* Built once per request: the server's arguments sorted by name, so each
+   setting finds its field with a binary search instead of a linear
+   hasArg()/arg() scan per field. */
+class SettingsArgs {
+public:
+    SettingsArgs() {}
+    explicit SettingsArgs(WebServer& srv) { collect(srv); }
+
+    /* copies all request arguments and sorts them */
+    void collect(WebServer& srv);
+
+    /* fills the index from a flat JSON object ({"key": scalar | [scalars]});
+       array elements become "key_<i>". Marks the index as partial. */
+    bool parseJson(const String& body, const char** error = nullptr);
+
+    /* partial updates leave absent fields alone (no unchecked-checkbox reset) */
+    bool partial() const { return partial_; }
+    /* member names of the object given to parseJson(), as posted */
+    const std::vector<String>& jsonKeys() const { return jsonKeys_; }
+
+    /* value posted for "key" or "key_<index>", nullptr if absent */
+    const String* find(const char* key, int index = -1) const;
+    /* prefix prepended to every key looked up by find() (combined forms) */
+    void setScope(const char* prefix) { scope_ = prefix ? prefix : ""; }
+    bool has(const char* key, int index = -1) const { return find(key, index) != nullptr; }
+
+    size_t size() const { return args_.size(); }
+
+private:
+    void sort_();
+
+    std::vector<std::pair<String, String>> args_;
+    std::vector<String> jsonKeys_;
+    bool partial_ = false;
+    const char* scope_ = "";
+};
 
 
 /*------------------------------------------------------------*/
 /* 2.  Abstract base for every setting                        */
 /*------------------------------------------------------------*/
+/* scope lock on a block's recursive mutex (no-op without one) */
+struct SettingsLock_ {
+    SemaphoreHandle_t m;
+    explicit SettingsLock_(SemaphoreHandle_t mtx) : m(mtx) { if (m) xSemaphoreTakeRecursive(m, portMAX_DELAY); }
+    ~SettingsLock_() { if (m) xSemaphoreGiveRecursive(m); }
+    SettingsLock_(const SettingsLock_&) = delete;
+    SettingsLock_& operator=(const SettingsLock_&) = delete;
+};
+
 struct SettingBase {
     enum ValueType {
         TYPE_FLOAT,
@@ -45,6 +101,20 @@ struct SettingBase {
     virtual void   load(Preferences&)                    = 0;
     virtual void   save(Preferences&)              const = 0;
 
+    /* dirty tracking: compare against the value last loaded from / written to
+       NVS. Settings that don't track their state are always considered dirty. */
+    virtual bool   isDirty()                       const { return true; }
+    virtual void   markClean()                           {}
+
+    /* writes only what changed; returns the number of NVS writes issued and
+       adds the number of writes that could be skipped to 'skipped' */
+    virtual size_t saveChanged(Preferences& p, size_t& skipped) {
+        if (!isDirty()) { ++skipped; return 0; }
+        save(p);
+        markClean();
+        return 1;
+    }
+
     void setPrecisionFromStep(float step) {
         const float eps = 1e-6f;  // tolerance for float rounding
         float x = step;
@@ -57,8 +127,62 @@ struct SettingBase {
         precision = prec;
     }
 
-    virtual void appendHTMLInputs(String& html) const = 0;
-    virtual void onPost(WebServer& srv) = 0;
+    /* JSON: value literal and type name for GET <url>.json */
+    virtual void writeJSONValue(JsonWriter& j) const { j.value(toString()); }
+    virtual bool isArray() const { return false; }
+    const char* typeName() const {
+        static const char* const names[]  = { "float",   "int",   "bool",   "string",   "ip",   "mac"   };
+        static const char* const arrays[] = { "float[]", "int[]", "bool[]", "string[]", "ip[]", "mac[]" };
+        return isArray() ? arrays[valueType] : names[valueType];
+    }
+    /* HTML rendering: inputs are written straight into the (chunked) writer */
+    virtual void writeHTMLInputs(ChunkedWriter& w) const = 0;
+    void appendHTMLInputs(String& html) const {
+        StringChunkWriter w(html);
+        writeHTMLInputs(w);
+    }
+    /* applies this setting's field(s) from the request; true if the value changed */
+    virtual bool onPost(const SettingsArgs& args) = 0;
+
+    /* The same output, written from a copy taken while the block mutex 'm'
+       is held: 'w' may flush to the socket, and a slow client must not keep
+       the tasks that change or save values waiting. The default copies the
+       rendered text, which for scalars fits a stack buffer; arrays copy
+       their elements instead. */
+    virtual void writeHTMLInputsCopy(ChunkedWriter& w, SemaphoreHandle_t m) const {
+        RenderCopy_ c;
+        copy_(c, m, w.fieldPrefix(), [this](ChunkedWriter& o) { writeHTMLInputs(o); });
+        w.write(c.data(), c.size());
+    }
+    virtual void writeJSONValueCopy(JsonWriter& j, SemaphoreHandle_t m) const {
+        const JsonWriter::Format f = j.cbor() ? JsonWriter::Format::Cbor : JsonWriter::Format::Json;
+        RenderCopy_ c;
+        copy_(c, m, nullptr, [this, f](ChunkedWriter& o) { JsonWriter v(o, f); writeJSONValue(v); });
+        j.encoded(c.data(), c.size());
+    }
+
+private:
+    /* rendered output; 'spill' only when it does not fit 'buf' */
+    struct RenderCopy_ {
+        char   buf[128];
+        size_t len = 0;
+        String spill;
+        const char* data() const { return spill.length() ? spill.c_str() : buf; }
+        size_t      size() const { return spill.length() ? spill.length() : len; }
+    };
+    template <typename Render>
+    static void copy_(RenderCopy_& c, SemaphoreHandle_t m, const char* fieldPrefix, Render render) {
+        SettingsLock_ l(m);
+        BufferChunkWriter b(c.buf, sizeof(c.buf));
+        b.setFieldPrefix(fieldPrefix);
+        render(b);
+        c.len = b.length();
+        if (!b.overflowed()) return;
+        c.spill.reserve(b.bytesWritten());
+        StringChunkWriter sw(c.spill);
+        sw.setFieldPrefix(fieldPrefix);
+        render(sw);
+    }
 };
 
 template<typename T>
@@ -72,7 +196,7 @@ public:
             const char* lbl,
             T defaultVal,
             float st = 0.01f)
-        : value(defaultVal)
+        : value(defaultVal), stored_(defaultVal)
     {
         key   = k;
         label = lbl;
@@ -103,7 +227,7 @@ public:
 
     String toString() const override {
         if      (valueType == TYPE_BOOL)  return value ? "1" : "0";
-        else if (valueType == TYPE_FLOAT) return String(static_cast<float>(value), precision);
+        else if (valueType == TYPE_FLOAT) return NumberFormat::toString(static_cast<float>(value), precision);
         else                              return String(value);          // int
     }
 
@@ -119,21 +243,37 @@ public:
         else                             p.putFloat(key, value);
     }
 
-    void appendHTMLInputs(String& html) const override {
-      if      (valueType == TYPE_BOOL) {
-        html += "<input type='checkbox' name='" + String(key) + "' value='1' ";
-        html += (value ? "checked " : "");
-        html += ">\n";
-      } else if (valueType == TYPE_STRING) {
-        html += "<input type='text' name='" + String(key) + "' value='" + toString() + "'>\n";
+    bool isDirty() const override { return value != stored_; }
+    void markClean() override     { stored_ = value; }
+
+    void writeHTMLInputs(ChunkedWriter& w) const override {
+      if (valueType == TYPE_BOOL) {
+        w.write(F("<input type='checkbox' name='"));
+        w.writeFieldName(key);
+        w.write(value ? F("' value='1' checked >\n") : F("' value='1' >\n"));
       } else {
-        html += "<input type='text' inputmode='decimal' name='" + String(key) + "' value='" + toString() + "'>\n";
+        w.write(F("<input type='text' inputmode='decimal' name='"));
+        w.writeFieldName(key);
+        w.write(F("' value='"));
+        if (valueType == TYPE_FLOAT) w.writeFloat(static_cast<float>(value), precision);
+        else                         w.writeInt(static_cast<int32_t>(value));
+        w.write(F("'>\n"));
       }
     }
-    void onPost(WebServer& srv) override {
-      if (srv.hasArg(key)) fromString(srv.arg(key));
-      else if (valueType == TYPE_BOOL) value = false; // unchecked checkbox
+    void writeJSONValue(JsonWriter& j) const override {
+      if      (valueType == TYPE_BOOL)  j.value(static_cast<bool>(value));
+      else if (valueType == TYPE_FLOAT) j.value(static_cast<float>(value), precision);
+      else                              j.value(static_cast<int32_t>(value));
     }
+    bool onPost(const SettingsArgs& args) override {
+      const T old = value;
+      if (const String* raw = args.find(key)) fromString(*raw);
+      else if (valueType == TYPE_BOOL && !args.partial()) value = false; // unchecked checkbox
+      return value != old;
+    }
+
+private:
+    T stored_;   // last value loaded from / written to NVS
 };
 /*------------------------------------------------------------*/
 /*------------- Helper functions for IP and MACAddress  ------*/
@@ -201,7 +341,7 @@ public:
             const char* lbl,
             const IPAddress& defaultVal = IPAddress(),
             float /*st*/ = 1.0f)
-        : value(defaultVal)
+        : value(defaultVal), stored_(defaultVal)
     {
         key       = k;
         label     = lbl;
@@ -241,16 +381,30 @@ public:
         p.putString(key, toString());
     }
 
-    void appendHTMLInputs(String& html) const override {
-        html += "<input type='text' name='" + String(key) +
-                "' value='" + toString() + "'>\n";
-    }
+    bool isDirty() const override { return !(value == stored_); }
+    void markClean() override     { stored_ = value; }
 
-    void onPost(WebServer& srv) override {
-        if (srv.hasArg(key)) {
-            fromString(srv.arg(key));
+    void writeHTMLInputs(ChunkedWriter& w) const override {
+        w.write(F("<input type='text' name='"));
+        w.writeFieldName(key);
+        w.write(F("' value='"));
+        for (int i = 0; i < 4; ++i) {
+            if (i) w.write('.');
+            w.writeUInt(value[i]);
         }
+        w.write(F("'>\n"));
+    }
+
+    bool onPost(const SettingsArgs& args) override {
+        const String* raw = args.find(key);
+        if (!raw) return false;
+        const IPAddress old = value;
+        fromString(*raw);
+        return !(value == old);
     }
+
+private:
+    IPAddress stored_;   // last value loaded from / written to NVS
 };
 
 /*------------------------------------------------------------*/
@@ -268,7 +422,7 @@ public:
             const char* lbl,
             const tcpmsg::MACAddress& defaultVal = tcpmsg::MACAddress(),
             float /*st*/ = 1.0f)
-        : value(defaultVal)
+        : value(defaultVal), stored_(defaultVal)
     {
         key       = k;
         label     = lbl;
@@ -309,16 +463,33 @@ public:
         p.putString(key, toString());
     }
 
-    void appendHTMLInputs(String& html) const override {
-        html += "<input type='text' name='" + String(key) +
-                "' value='" + toString() + "'>\n";
+    bool isDirty() const override {
+        return memcmp(value.bytes(), stored_.bytes(), 6) != 0;
+    }
+    void markClean() override     { stored_ = value; }
+
+    void writeHTMLInputs(ChunkedWriter& w) const override {
+        const uint8_t* b = value.bytes();
+        char tmp[18];
+        std::snprintf(tmp, sizeof(tmp), "%02X:%02X:%02X:%02X:%02X:%02X",
+                      b[0], b[1], b[2], b[3], b[4], b[5]);
+        w.write(F("<input type='text' name='"));
+        w.writeFieldName(key);
+        w.write(F("' value='"));
+        w.write(tmp);
+        w.write(F("'>\n"));
     }
 
-    void onPost(WebServer& srv) override {
-        if (srv.hasArg(key)) {
-            fromString(srv.arg(key));
-        }
+    bool onPost(const SettingsArgs& args) override {
+        const String* raw = args.find(key);
+        if (!raw) return false;
+        const tcpmsg::MACAddress old = value;
+        fromString(*raw);
+        return memcmp(old.bytes(), value.bytes(), 6) != 0;
     }
+
+private:
+    tcpmsg::MACAddress stored_;   // last value loaded from / written to NVS
 };
 
 
@@ -336,7 +507,7 @@ public:
             const char* lbl,
             const String& defaultVal = String(),
             float /*st*/ = 1.0f)
-        : value(defaultVal)
+        : value(defaultVal), stored_(defaultVal)
     {
         key        = k;
         label      = lbl;
@@ -364,21 +535,46 @@ public:
         p.putString(key, value);
     }
 
-    void appendHTMLInputs(String& html) const override {
-       html += "<input type='text' name='" + String(key) + "' value='" + toString() + "'>\n";
+    bool isDirty() const override { return value != stored_; }
+    void markClean() override     { stored_ = value; }
+
+    void writeHTMLInputs(ChunkedWriter& w) const override {
+       w.write(F("<input type='text' name='"));
+       w.writeFieldName(key);
+       w.write(F("' value='"));
+       w.writeHtmlEscaped(value);
+       w.write(F("'>\n"));
     }
-    void onPost(WebServer& srv) override {
-      if (srv.hasArg(key)) fromString(srv.arg(key));
+    void writeJSONValue(JsonWriter& j) const override { j.value(value); }
+    bool onPost(const SettingsArgs& args) override {
+      const String* raw = args.find(key);
+      if (!raw || *raw == value) return false;
+      value = *raw;
+      return true;
     }
+
+private:
+    String stored_;   // last value loaded from / written to NVS
 };
 
 /*------------------------------------------------------------*/
 /* 4.  Generic “settings block”                               */
 /*------------------------------------------------------------*/
+/* receives the block's values whenever they were (re)loaded or posted,
+   see SettingsSnapshot.h */
+class SettingsSnapshotBase {
+public:
+    virtual ~SettingsSnapshotBase() {}
+protected:
+    friend class SettingsBlockBase;
+    virtual void publish_() = 0;   // called with the block lock held
+};
+
 class SettingsBlockBase {
 public:
     SettingsBlockBase(const char* nvs, const char* url)
-      : nvsNS(nvs), urlPath(url) {}
+      : nvsNS(nvs), urlPath(url), mutex_(xSemaphoreCreateRecursiveMutex()) {}
+    virtual ~SettingsBlockBase() {}
 
     //overload for arduino string
     //SettingsBlockBase(const String& nvs, const String& url)
@@ -386,73 +582,373 @@ public:
 
     /* lifecycle */
     void begin() { prefs.begin(nvsNS); load(); }
-    void load()  { for (auto* s : registry) s->load(prefs); }
-    void save()  { for (auto* s : registry) s->save(prefs); }
+    void load()  { Lock_ l(mutex_); loadSettings_(prefs); publishSnapshots_(); }
+
+    /* writes only settings that differ from what NVS holds */
+    void save() {
+        Lock_ l(mutex_);
+        lastSaveWrites_  = 0;
+        lastSaveSkipped_ = 0;
+        lastSaveWrites_  = saveSettings_(prefs, false, lastSaveSkipped_);
+    }
+    /* unconditionally writes every setting */
+    void saveAll() { Lock_ l(mutex_); size_t skipped = 0; saveSettings_(prefs, true, skipped); }
+
+    /* write-behind: POSTs queue the save on SettingsSaveQueue instead of
+       committing to NVS inside the HTTP handler (once the queue was started
+       with SettingsSaveQueue::begin(), until then saves stay synchronous) */
+    void setDeferredSave(bool on) { deferredSave_ = on; }
+    bool deferredSave() const     { return deferredSave_; }
+
+    const char* url() const { return urlPath; }
+
+    /* NVS writes issued / skipped by the last save() */
+    size_t lastSaveWrites()  const { return lastSaveWrites_; }
+    size_t lastSaveSkipped() const { return lastSaveSkipped_; }
 
     /* expose this so Setting<T> can call it */
     void registerSetting(SettingBase* s) { registry.push_back(s); }
 
     virtual bool sanityCheck() {return true;} // override in derived classes if needed, can change values
 
+    /* Change observers. They fire once per POST that changed something, once
+       sanityCheck() accepted the values and they were saved (or queued for
+       saving); a POST that fails sanityCheck() reports nothing. The keys of
+       all changed settings of the block are delivered together.
+         task == nullptr : called right away on the web server task
+         task != nullptr : queued for that task, which is woken with
+                           xTaskNotifyGive() and must call dispatchChanges()
+                           (e.g. `if (ulTaskNotifyTake(pdTRUE, 0)) block.dispatchChanges();`).
+                           Changes arriving before the dispatch are merged. */
+    using ChangeCallback = std::function<void(const std::vector<const char*>& keys)>;
+
+    void onChange(ChangeCallback cb, TaskHandle_t task = nullptr) {
+        addObserver_(nullptr, std::move(cb), task);
+    }
+    void onSettingChange(const char* key, std::function<void()> cb, TaskHandle_t task = nullptr) {
+        addObserver_(key, [cb](const std::vector<const char*>&){ cb(); }, task);
+    }
+    void onSettingChange(const SettingBase& s, std::function<void()> cb, TaskHandle_t task = nullptr) {
+        onSettingChange(s.key, std::move(cb), task);
+    }
+
+    /* snapshots (SettingsSnapshot.h) are refreshed after load() and after each
+       POST; call publish() after changing values from firmware */
+    void attachSnapshot(SettingsSnapshotBase* s) {
+        Lock_ l(mutex_);
+        snapshots_.push_back(s);
+        s->publish_();
+    }
+    void publish() { Lock_ l(mutex_); publishSnapshots_(); }
+
+    /* Holds the block lock, so no POST (nor a save or load) runs while it
+       lives. Needed when a task other than the one serving the page touches
+       Setting<T>::value directly, e.g. loop() after
+       BasicWebInterface::startTask():
+         { SettingsBlockBase::Guard g(pump); target = pump.host.value; }
+       Keep it short: requests for this block wait for it. */
+    class Guard {
+    public:
+        explicit Guard(const SettingsBlockBase& block) : m_(block.mutex_) {
+            if (m_) xSemaphoreTakeRecursive(m_, portMAX_DELAY);
+        }
+        ~Guard() { if (m_) xSemaphoreGiveRecursive(m_); }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    private:
+        SemaphoreHandle_t m_;
+    };
+
+    /* runs the callbacks queued for the calling task */
+    void dispatchChanges() {
+        const TaskHandle_t self = xTaskGetCurrentTaskHandle();
+        std::vector<std::pair<ChangeCallback, std::vector<const char*>>> due;
+        {
+            Lock_ l(mutex_);
+            for (auto& o : observers_) {
+                if (o.task != self || o.pending.empty()) continue;
+                due.emplace_back(o.fn, std::vector<const char*>());
+                due.back().second.swap(o.pending);
+            }
+        }
+        for (auto& d : due) d.first(d.second);
+    }
+
     /* web integration */
     void setupRoutes(WebServer& srv)
     {
-        /* GET -> form */
-        srv.on(urlPath, HTTP_GET, [this, &srv](){
-            srv.send(200, "text/html", generateHTML());
-        });
+        /* GET -> form, streamed in chunks */
+        srv.on(urlPath, HTTP_GET, [this, &srv](){ streamHTML(srv); });
 
         /* POST -> check pw, update, save */
         String postPath = String(urlPath) + "/update";
-        srv.on(postPath.c_str(), HTTP_POST, [this, &srv](){
-            if (WebAuthPlugin::instance().isActive()) {
-                if (!WebAuthPlugin::instance().require()) return;   // uses postOnlyLockdown internally
-            } else {
-                if (!(srv.hasArg("pw") && srv.arg("pw") == kSettingsPassword)) {
-                    gLogger->println("Settings: " + String(urlPath) + " update failed: wrong password");
-                    srv.send(401, "text/html", "<h3>Wrong password</h3>");
-                    return;
-                }
-            }
+        srv.on(postPath.c_str(), HTTP_POST, [this, &srv](){ serveUpdate(srv); });
 
-            handlePost(srv);
-            save();
-            gLogger->println("Settings: " + String(urlPath) + " updated");
-            srv.sendHeader("Location", "/");  
-            srv.send(303);   
-        });
+        /* JSON API: GET -> all values with types, POST -> partial batch update
+           (a POST naming a key the block does not have is refused with 400) */
+        String jsonPath = String(urlPath) + ".json";
+        srv.on(jsonPath.c_str(), HTTP_GET,  [this, &srv](){ serveJson(srv); });
+        srv.on(jsonPath.c_str(), HTTP_POST, [this, &srv](){ serveJsonUpdate(srv); });
+    }
+
+    /* the route handlers on their own (e.g. for a RouteTable):
+         GET  <url>          streamHTML()
+         POST <url>/update   serveUpdate()
+         GET  <url>.json     serveJson()
+         POST <url>.json     serveJsonUpdate() */
+    void serveUpdate(WebServer& srv) {
+        const SettingsArgs args(srv);   // one pass over the request arguments
+        if (!authorizePost(srv, args, urlPath)) return;
+
+        handlePost(args);
+        commit_();
+        srv.sendHeader("Location", "/");
+        srv.send(303);
+    }
+
+    void serveJson(WebServer& srv) const {
+        ServerChunkWriter w(srv);
+        w.begin(200, "application/json");
+        writeJSON(w);
+        w.end();
+    }
+
+    void serveJsonUpdate(WebServer& srv) {
+        SettingsArgs args;
+        const char* error = nullptr;
+        if (!args.parseJson(srv.arg("plain"), &error)) {
+            ServerChunkWriter w(srv);
+            w.begin(400, "application/json");
+            JsonWriter(w).beginObject().member("ok", false).member("error", error).endObject();
+            return;
+        }
+        if (!authorizePost(srv, args, urlPath, true)) return;
+
+        // a misspelt key is refused as a whole instead of being dropped
+        std::vector<const char*> unknown;
+        for (const String& k : args.jsonKeys()) {
+            if (k != "pw" && !hasKey_(k.c_str())) unknown.push_back(k.c_str());
+        }
+        if (!unknown.empty()) {
+            ServerChunkWriter w(srv);
+            w.begin(400, "application/json");
+            JsonWriter j(w);
+            j.beginObject().member("ok", false).member("error", "unknown keys").key("unknown").beginArray();
+            for (const char* k : unknown) j.value(k);
+            j.endArray().endObject();
+            return;
+        }
+
+        const bool sane = handlePost(args);
+        commit_();
+        ServerChunkWriter w(srv);
+        w.begin(200, "application/json");
+        JsonWriter j(w);
+        j.beginObject().member("ok", true).member("sane", sane);
+        if (savesDeferred_()) {
+            j.member("queued", true);
+        } else {
+            j.member("written", (uint32_t)lastSaveWrites_).member("unchanged", (uint32_t)lastSaveSkipped_);
+        }
+        j.endObject();
+    }
+
+    /* login session if WebAuthPlugin is active, else the "pw" field; sends
+       401 (HTML or JSON) and returns false when the request is refused */
+    static bool authorizePost(WebServer& srv, const SettingsArgs& args, const char* what, bool json = false) {
+        if (WebAuthPlugin::instance().isActive()) {
+            return WebAuthPlugin::instance().require();   // uses postOnlyLockdown internally
+        }
+        const String* pw = args.find("pw");
+        if (pw && *pw == kSettingsPassword) return true;
+        gLogger->println("Settings: " + String(what) + " update failed: wrong password");
+        if (json) srv.send(401, "application/json", "{\"ok\":false,\"error\":\"wrong password\"}");
+        else      srv.send(401, "text/html", "<h3>Wrong password</h3>");
+        return false;
     }
 
+    /* building blocks for pages that post several blocks at once
+       (see BasicWebInterface::setCombinedSettingsForm) */
+    void writeInputs(ChunkedWriter& w) const  { writeInputs_(w); }
+    bool applyPost(const SettingsArgs& args) { return handlePost(args); }   // false: sanity check failed
+    void commit()                            { commit_(); }
+
     /* public so you can embed it in your own pages */
+    void writeHTML(ChunkedWriter& w) const {
+        w.write(F("<form method='POST' action='"));
+        w.write(urlPath);
+        w.write(F("/update'>\n"));
+
+        writeInputs_(w);
+        if (!WebAuthPlugin::instance().isActive()) {
+            w.write(F("Password: <input type='password' name='pw'><br><br>\n"));
+        }
+        w.write(F("<input type='submit' value='Save'></form>\n"));
+    }
+
+    /* {"key":{"type":"float","value":1.5}, ...} */
+    void writeJSON(ChunkedWriter& w) const {
+        JsonWriter j(w);
+        j.beginObject();
+        writeJSONValues_(j);
+        j.endObject();
+    }
+
     String generateHTML() const {
         String html;
         html.reserve(1024);
-        html  = "<form method='POST' action='";
-        html += String(urlPath) + "/update'>\n";
-    
-        for (auto* s : registry) {
-            html += String(s->label) + ": ";
-            s->appendHTMLInputs(html);
-            html += "<br>\n";
-        }
-        if (!WebAuthPlugin::instance().isActive()) {
-            html += "Password: <input type='password' name='pw'><br><br>\n";
-        }
-        html += "<input type='submit' value='Save'></form>\n";
+        StringChunkWriter w(html);
+        writeHTML(w);
+        w.flush();
         return html;
     }
 
+    /* sends the form as the complete response body (chunked transfer) */
+    void streamHTML(WebServer& srv) const {
+        ServerChunkWriter w(srv);
+        w.begin(200, "text/html");
+        writeHTML(w);
+        w.end();
+    }
+
     //password as static
     static String kSettingsPassword;
 
+protected:
+    /* Per-setting work. The defaults walk the Setting<T> registry; table-driven
+       blocks (see WebSettingsSchema.h) override these instead of registering
+       SettingBase objects. */
+    virtual void loadSettings_(Preferences& p) {
+        for (auto* s : registry) { s->load(p); s->markClean(); }
+    }
+    /* returns NVS writes; 'all' ignores dirty state */
+    virtual size_t saveSettings_(Preferences& p, bool all, size_t& skipped) {
+        size_t writes = 0;
+        for (auto* s : registry) {
+            if (all) { s->save(p); s->markClean(); ++writes; }
+            else     writes += s->saveChanged(p, skipped);
+        }
+        return writes;
+    }
+    /* "label: <inputs><br>" for every setting; each value is copied under
+       the block lock and written after it is released */
+    virtual void writeInputs_(ChunkedWriter& w) const {
+        for (auto* s : registry) {
+            w.write(s->label);
+            w.write(F(": "));
+            s->writeHTMLInputsCopy(w, mutex_);
+            w.write(F("<br>\n"));
+        }
+    }
+    /* "key":{"type":..,"value":..} members of the open object */
+    virtual void writeJSONValues_(JsonWriter& j) const {
+        for (const SettingBase* s : registry) {
+            j.key(s->key).beginObject().member("type", s->typeName()).key("value");
+            s->writeJSONValueCopy(j, mutex_);
+            j.endObject();
+        }
+    }
+    /* true if 'key' names a setting of this block (JSON API) */
+    virtual bool hasKey_(const char* key) const {
+        for (const SettingBase* s : registry) {
+            if (strcmp(s->key, key) == 0) return true;
+        }
+        return false;
+    }
+    /* applies a POST; appends the keys of settings whose value changed */
+    virtual void applyArgs_(const SettingsArgs& args, std::vector<const char*>& changed) {
+        for (auto* s : registry) {
+            if (s->onPost(args)) changed.push_back(s->key);
+        }
+    }
+
 private:
-    void handlePost(WebServer& srv)
+    /* serializes value updates (web task) against saves (write-behind task) */
+    using Lock_ = SettingsLock_;
+
+    /* deferred only while the write-behind task runs: before
+       SettingsSaveQueue::begin() request() saves synchronously */
+    bool savesDeferred_() const { return deferredSave_ && SettingsSaveQueue::instance().running(); }
+
+    /* persist after a POST: now, or queued on the write-behind task; then
+       tell the observers about the accepted changes */
+    void commit_() {
+        if (savesDeferred_()) {
+            SettingsSaveQueue::instance().request(this);
+            gLogger->println("Settings: " + String(urlPath) + " updated (save queued)");
+        } else {
+            save();
+            gLogger->println("Settings: " + String(urlPath) + " updated (" +
+                             String((unsigned)lastSaveWrites_) + " written, " +
+                             String((unsigned)lastSaveSkipped_) + " unchanged)");
+        }
+        std::vector<const char*> changed;
+        {
+            Lock_ l(mutex_);
+            changed.swap(accepted_);
+        }
+        notifyChanges_(changed);
+    }
+
+    bool handlePost(const SettingsArgs& args)
     {
-        for (auto* s : registry) s->onPost(srv);
-        if (!sanityCheck()) {
+        std::vector<const char*> changed;
+        bool sane;
+        {
+            Lock_ l(mutex_);
+            applyArgs_(args, changed);
+            sane = sanityCheck();
+            publishSnapshots_();
+            // reported by commit_(), and only if the values were accepted
+            if (sane) {
+                for (const char* k : changed) {
+                    if (!containsKey_(accepted_, k)) accepted_.push_back(k);
+                }
+            }
+        }
+        if (!sane) {
             gLogger->println("Settings: " + String(urlPath) + " sanity check failed (values might have been changed)");
-            return;
         }
+        return sane;
+    }
+
+    struct Observer_ {
+        const char*              key;      // nullptr: whole block
+        ChangeCallback           fn;
+        TaskHandle_t             task;     // nullptr: inline on the web task
+        std::vector<const char*> pending;  // keys waiting for dispatchChanges()
+    };
+
+    void publishSnapshots_() {
+        for (auto* s : snapshots_) s->publish_();
+    }
+
+    void addObserver_(const char* key, ChangeCallback fn, TaskHandle_t task) {
+        Lock_ l(mutex_);
+        observers_.push_back(Observer_{key, std::move(fn), task, {}});
+    }
+
+    static bool containsKey_(const std::vector<const char*>& keys, const char* key) {
+        for (const char* k : keys) if (strcmp(k, key) == 0) return true;
+        return false;
+    }
+
+    void notifyChanges_(const std::vector<const char*>& changed) {
+        if (changed.empty()) return;
+        std::vector<ChangeCallback> now;
+        {
+            Lock_ l(mutex_);
+            for (auto& o : observers_) {
+                if (o.key && !containsKey_(changed, o.key)) continue;
+                if (!o.task) { now.push_back(o.fn); continue; }
+                const bool wake = o.pending.empty();
+                for (const char* k : changed) {
+                    if (!containsKey_(o.pending, k)) o.pending.push_back(k);
+                }
+                if (wake) xTaskNotifyGive(o.task);
+            }
+        }
+        for (auto& fn : now) fn(changed);   // outside the lock: callbacks may read/save the block
     }
 
     /* data */
@@ -460,6 +956,13 @@ private:
     const char*               urlPath;
     Preferences               prefs;
     std::vector<SettingBase*> registry;
+    size_t                    lastSaveWrites_  = 0;
+    size_t                    lastSaveSkipped_ = 0;
+    SemaphoreHandle_t         mutex_           = nullptr;
+    std::vector<const char*>  accepted_;       // changed keys waiting for commit_()
+    bool                      deferredSave_    = false;
+    std::vector<Observer_>    observers_;
+    std::vector<SettingsSnapshotBase*> snapshots_;
 };
 
 /*------------------------------------------------------------*/
@@ -479,11 +982,16 @@ template<typename T>
 struct SettingArrayIO<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
   static T load(Preferences& p, const char* k, T def) { return (T)p.getFloat(k, (float)def); }
   static void save(Preferences& p, const char* k, T v){ p.putFloat(k, (float)v); }
-  static String toStr(const T& v, unsigned precision){ return String((float)v, precision); }
+  static String toStr(const T& v, unsigned precision){ return NumberFormat::toString((float)v, precision); }
   static T fromStr(const String& s){ return (T)s.toFloat(); }
-  static void appendInput(String& html, const String& name, const String& val, bool /*checked*/) {
-    html += "<input type='text' inputmode='decimal' name='" + name + "' value='" + val + "'>";
+  static void writeInput(ChunkedWriter& w, const char* key, size_t i, const T& v, unsigned precision) {
+    w.write(F("<input type='text' inputmode='decimal' name='"));
+    w.writeFieldName(key, (int)i);
+    w.write(F("' value='"));
+    w.writeFloat((float)v, precision);
+    w.write(F("'>"));
   }
+  static void writeJson(JsonWriter& j, const T& v, unsigned precision) { j.value((float)v, precision); }
 };
 
 /* integral (except bool) */
@@ -493,9 +1001,14 @@ struct SettingArrayIO<T, typename std::enable_if<std::is_integral<T>::value && !
   static void save(Preferences& p, const char* k, T v){ p.putInt(k, (int)v); }
   static String toStr(const T& v, unsigned){ return String((int)v); }
   static T fromStr(const String& s){ return (T)s.toInt(); }
-  static void appendInput(String& html, const String& name, const String& val, bool /*checked*/) {
-    html += "<input type='text' inputmode='decimal' name='" + name + "' value='" + val + "'>";
+  static void writeInput(ChunkedWriter& w, const char* key, size_t i, const T& v, unsigned) {
+    w.write(F("<input type='text' inputmode='decimal' name='"));
+    w.writeFieldName(key, (int)i);
+    w.write(F("' value='"));
+    w.writeInt((int32_t)v);
+    w.write(F("'>"));
   }
+  static void writeJson(JsonWriter& j, const T& v, unsigned) { j.value((int32_t)v); }
 };
 
 /* bool */
@@ -505,11 +1018,12 @@ struct SettingArrayIO<T, typename std::enable_if<std::is_same<T,bool>::value>::t
   static void save(Preferences& p, const char* k, T v){ p.putBool(k, (bool)v); }
   static String toStr(const T& v, unsigned){ return v ? "1" : "0"; }
   static T fromStr(const String& s){ return (s == "1" || s == "true" || s == "on"); }
-  static void appendInput(String& html, const String& name, const String& /*val*/, bool checked) {
-    html += "<input type='checkbox' name='" + name + "' value='1' ";
-    html += (checked ? "checked " : "");
-    html += ">";
+  static void writeInput(ChunkedWriter& w, const char* key, size_t i, const T& v, unsigned) {
+    w.write(F("<input type='checkbox' name='"));
+    w.writeFieldName(key, (int)i);
+    w.write(v ? F("' value='1' checked >") : F("' value='1' >"));
   }
+  static void writeJson(JsonWriter& j, const T& v, unsigned) { j.value((bool)v); }
 };
 
 /* Arduino String */
@@ -519,27 +1033,32 @@ struct SettingArrayIO<T, typename std::enable_if<std::is_same<T, String>::value>
   static void save(Preferences& p, const char* k, const T& v){ p.putString(k, v); }
   static String toStr(const T& v, unsigned){ return v; }
   static T fromStr(const String& s){ return s; }
-  static void appendInput(String& html, const String& name, const String& val, bool /*checked*/) {
-    html += "<input type='text' name='" + name + "' value='" + htmlEscape_(val) + "'>";
-  }
-private:
-  static String htmlEscape_(const String& s) {
-    String out; out.reserve(s.length()+8);
-    for (size_t i=0;i<s.length();++i) {
-      char c=s[i];
-      if (c=='&') out += "&amp;";
-      else if (c=='<') out += "&lt;";
-      else if (c=='>') out += "&gt;";
-      else if (c=='"') out += "&quot;";
-      else out += c;
-    }
-    return out;
+  static void writeInput(ChunkedWriter& w, const char* key, size_t i, const T& v, unsigned) {
+    w.write(F("<input type='text' name='"));
+    w.writeFieldName(key, (int)i);
+    w.write(F("' value='"));
+    w.writeHtmlEscaped(v);
+    w.write(F("'>"));
   }
+  static void writeJson(JsonWriter& j, const T& v, unsigned) { j.value(v); }
 };
 
 
 /***************  SettingDynArray<T>  ************************/
 
+/* Packed NVS layout: header followed by 'count' raw elements, stored under
+   the array's own key. Used for arithmetic element types. */
+#ifndef WEBSETTINGS_ARRAY_BLOB_DEFAULT
+#define WEBSETTINGS_ARRAY_BLOB_DEFAULT 1
+#endif
+
+struct SettingArrayBlobHeader {
+  uint8_t  version;
+  uint8_t  elemSize;
+  uint16_t count;
+};
+static constexpr uint8_t kSettingArrayBlobVersion = 1;
+
 template<typename T>
 class SettingDynArray : public SettingBase {
 public:
@@ -560,6 +1079,7 @@ public:
     setPrecisionFromStep(step);
     setValueType_();
     value.assign(len, fillDefault);
+    stored_ = value;
     owner.registerSetting(this);
     default_ = fillDefault;  // remember for resizing
   }
@@ -578,6 +1098,7 @@ public:
     setPrecisionFromStep(step);
     setValueType_();
     value.assign(initVals.begin(), initVals.end());
+    stored_ = value;
     owner.registerSetting(this);
     
   }
@@ -596,50 +1117,191 @@ public:
   void   fromString(const String&) override {}
   String toString() const override { return String(); }
 
-  /* NVS I/O: one key per element: key_0, key_1, ... */
+  /* NVS storage: either one packed blob under 'key' (default for numbers and
+     bools) or the legacy layout with one key per element: key_0, key_1, ...
+     String arrays always use the per-element layout. */
+  enum StorageMode { STORAGE_PER_ELEMENT, STORAGE_BLOB };
+  void setStorageMode(StorageMode m) { storage_ = m; }
+  StorageMode storageMode() const    { return storage_; }
+
   void load(Preferences& p) override {
-    const size_t N = value.size();
-    for (size_t i = 0; i < N; ++i) {
-      String ki = String(key) + "_" + String((unsigned)i);
-      value[i] = SettingArrayIO<T>::load(p, ki.c_str(), value[i]);
+    if (!useBlob_()) { loadPerElement_(p, false); return; }
+    if (loadBlob_(p)) return;
+    /* a blob we cannot read (newer firmware, other element type) is left
+       alone: it is only replaced once the user saves this array */
+    if (p.isKey(key)) return;
+
+    /* no blob yet: pick up legacy keys (if any) and write the blob once, so
+       later boots need a single lookup */
+    const size_t legacy = loadPerElement_(p, true);
+    saveBlob_(p);
+    if (legacy) {
+      removeLegacyKeys_(p);
+      gLogger->println("Settings: array " + String(key) + " migrated to blob storage");
     }
   }
   void save(Preferences& p) const override {
-    const size_t N = value.size();
-    for (size_t i = 0; i < N; ++i) {
-      String ki = String(key) + "_" + String((unsigned)i);
-      SettingArrayIO<T>::save(p, ki.c_str(), value[i]);
+    if (useBlob_()) saveBlob_(p);
+    else            savePerElement_(p, nullptr);
+  }
+
+  /* dirty tracking per element */
+  bool isDirty() const override { return value != stored_; }
+  void markClean() override     { stored_ = value; }
+
+  size_t saveChanged(Preferences& p, size_t& skipped) override {
+    size_t writes = 0;
+    if (useBlob_()) {
+      if (isDirty()) { saveBlob_(p); writes = 1; }
+      else           ++skipped;
+    } else {
+      writes = savePerElement_(p, &skipped);
     }
+    markClean();
+    return writes;
   }
 
   /* HTML rendering */
-  void appendHTMLInputs(String& html) const override {
-    const size_t N = value.size();
-    html += "<span>";
-    for (size_t i = 0; i < N; ++i) {
-      const String fname = String(key) + "_" + String((unsigned)i);
-      const String sval  = SettingArrayIO<T>::toStr(value[i], precision);
-      SettingArrayIO<T>::appendInput(html, fname, sval, checked_(i));
-      html += " ";
-    }
-    html += "</span>";
+  void writeHTMLInputs(ChunkedWriter& w) const override { writeInputs_(w, value); }
+  void writeHTMLInputsCopy(ChunkedWriter& w, SemaphoreHandle_t m) const override {
+    std::vector<T> v;
+    { SettingsLock_ l(m); v = value; }
+    writeInputs_(w, v);
+  }
+
+  /* JSON: [v0,v1,...] */
+  bool isArray() const override { return true; }
+  void writeJSONValue(JsonWriter& j) const override { writeJson_(j, value); }
+  void writeJSONValueCopy(JsonWriter& j, SemaphoreHandle_t m) const override {
+    std::vector<T> v;
+    { SettingsLock_ l(m); v = value; }
+    writeJson_(j, v);
   }
 
   /* POST handling */
-  void onPost(WebServer& srv) override {
+  bool onPost(const SettingsArgs& args) override {
+    bool changed = false;
     const size_t N = value.size();
     for (size_t i = 0; i < N; ++i) {
-      String fname = String(key) + "_" + String((unsigned)i);
-      if (srv.hasArg(fname)) {
-        value[i] = SettingArrayIO<T>::fromStr(srv.arg(fname));
+      if (const String* raw = args.find(key, (int)i)) {
+        const T v = SettingArrayIO<T>::fromStr(*raw);
+        if (!(v == value[i])) { value[i] = v; changed = true; }
       } else {
-        setMissing_(i); // only flips to false for bool; no-op for others
+        if (!args.partial()) changed |= setMissing_(i); // only flips to false for bool; no-op for others
       }
     }
+    return changed;
   }
 
 private:
   T default_;
+  std::vector<T> stored_;   // last values loaded from / written to NVS
+  StorageMode storage_ = WEBSETTINGS_ARRAY_BLOB_DEFAULT ? STORAGE_BLOB : STORAGE_PER_ELEMENT;
+
+  bool useBlob_() const { return storage_ == STORAGE_BLOB && std::is_arithmetic<T>::value; }
+
+  void writeInputs_(ChunkedWriter& w, const std::vector<T>& v) const {
+    w.write(F("<span>"));
+    for (size_t i = 0; i < v.size(); ++i) {
+      SettingArrayIO<T>::writeInput(w, key, i, v[i], precision);
+      w.write(' ');
+    }
+    w.write(F("</span>"));
+  }
+  void writeJson_(JsonWriter& j, const std::vector<T>& v) const {
+    j.beginArray();
+    for (size_t i = 0; i < v.size(); ++i) SettingArrayIO<T>::writeJson(j, v[i], precision);
+    j.endArray();
+  }
+
+  /* NVS keys are at most 15 characters, the buffer only needs to hold that */
+  void elementKey_(char* buf, size_t len, size_t i) const {
+    std::snprintf(buf, len, "%s_%u", key, (unsigned)i);
+  }
+
+  /* with 'probe', returns the number of element keys found in NVS */
+  size_t loadPerElement_(Preferences& p, bool probe) {
+    char ki[24];
+    size_t found = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+      elementKey_(ki, sizeof(ki), i);
+      if (probe && !p.isKey(ki)) continue;
+      value[i] = SettingArrayIO<T>::load(p, ki, value[i]);
+      ++found;
+    }
+    return found;
+  }
+  /* writes all elements, or only changed ones when 'skipped' is given */
+  size_t savePerElement_(Preferences& p, size_t* skipped) const {
+    char ki[24];
+    size_t writes = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+      if (skipped && i < stored_.size() && value[i] == stored_[i]) { ++*skipped; continue; }
+      elementKey_(ki, sizeof(ki), i);
+      SettingArrayIO<T>::save(p, ki, value[i]);
+      ++writes;
+    }
+    return writes;
+  }
+  void removeLegacyKeys_(Preferences& p) const {
+    char ki[24];
+    for (size_t i = 0; i < value.size(); ++i) {
+      elementKey_(ki, sizeof(ki), i);
+      p.remove(ki);
+    }
+  }
+
+  /* blob layout: SettingArrayBlobHeader + count * sizeof(T).
+     SFINAE: only arithmetic element types can be stored raw */
+  template<typename U=T>
+  typename std::enable_if<std::is_arithmetic<U>::value, bool>::type
+  loadBlob_(Preferences& p) {
+    const size_t len = p.getBytesLength(key);
+    if (len < sizeof(SettingArrayBlobHeader)) return false;
+    std::vector<uint8_t> buf(len);
+    if (p.getBytes(key, buf.data(), len) != len) return false;
+
+    SettingArrayBlobHeader h;
+    memcpy(&h, buf.data(), sizeof(h));
+    if (h.version != kSettingArrayBlobVersion || h.elemSize != sizeof(T) ||
+        len != sizeof(h) + (size_t)h.count * sizeof(T)) {
+      gLogger->println("Settings: array " + String(key) + " has an unknown blob layout, using defaults");
+      return false;
+    }
+    /* length changed in firmware: keep defaults for new elements, drop extra ones */
+    const size_t n = std::min<size_t>(h.count, value.size());
+    const uint8_t* src = buf.data() + sizeof(h);
+    for (size_t i = 0; i < n; ++i) {
+      T v;
+      memcpy(&v, src + i * sizeof(T), sizeof(T));
+      value[i] = v;
+    }
+    return true;
+  }
+  template<typename U=T>
+  typename std::enable_if<std::is_arithmetic<U>::value, void>::type
+  saveBlob_(Preferences& p) const {
+    SettingArrayBlobHeader h;
+    h.version  = kSettingArrayBlobVersion;
+    h.elemSize = sizeof(T);
+    h.count    = (uint16_t)value.size();
+    std::vector<uint8_t> buf(sizeof(h) + value.size() * sizeof(T));
+    memcpy(buf.data(), &h, sizeof(h));
+    uint8_t* dst = buf.data() + sizeof(h);
+    for (size_t i = 0; i < value.size(); ++i) {
+      const T v = value[i];
+      memcpy(dst + i * sizeof(T), &v, sizeof(T));
+    }
+    p.putBytes(key, buf.data(), buf.size());
+  }
+
+  template<typename U=T>
+  typename std::enable_if<!std::is_arithmetic<U>::value, bool>::type
+  loadBlob_(Preferences&) { return false; }
+
+  template<typename U=T>
+  typename std::enable_if<!std::is_arithmetic<U>::value, void>::type
+  saveBlob_(Preferences&) const { /* never used: useBlob_() is false */ }
   void setValueType_() {
     if      (std::is_same<T,bool>::value)    valueType = TYPE_BOOL;
     else if (std::is_same<T, String>::value) valueType = TYPE_STRING;
@@ -647,23 +1309,14 @@ private:
     else                                     valueType = TYPE_FLOAT;
   }
 
-  /* SFINAE: checkbox state only for bool */
+  /* SFINAE: set false on missing POST only for bool */
   template<typename U=T>
   typename std::enable_if<std::is_same<U,bool>::value, bool>::type
-  checked_(size_t i) const { return (bool)value[i]; }
+  setMissing_(size_t i) { if (!value[i]) return false; value[i] = false; return true; }
 
   template<typename U=T>
   typename std::enable_if<!std::is_same<U,bool>::value, bool>::type
-  checked_(size_t) const { return false; }
-
-  /* SFINAE: set false on missing POST only for bool */
-  template<typename U=T>
-  typename std::enable_if<std::is_same<U,bool>::value, void>::type
-  setMissing_(size_t i) { value[i] = false; }
-
-  template<typename U=T>
-  typename std::enable_if<!std::is_same<U,bool>::value, void>::type
-  setMissing_(size_t) { /* no-op */ }
+  setMissing_(size_t) { return false; /* no-op */ }
 };
 
 #define DEF_SETTING_ARRAY(TYPE, NAME, LABEL, DEFAULT_VAL, STEP, LENGTH) \
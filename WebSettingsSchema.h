@@ -0,0 +1,219 @@
+/* ===========================================================
+   WebSettingsSchema.h
+
+   Table-driven alternative to DEF_SETTING for large blocks.
+   The schema (key, label, type, step, precision, default) is a
+   constexpr table that the compiler places in flash (.rodata,
+   which on the ESP32 is read straight from flash – PROGMEM is
+   not needed). Only a plain struct of values lives in RAM.
+
+   Usage:
+     struct PumpValues {
+         float   flow;
+         int32_t cycles;
+         bool    enabled;
+     };
+     constexpr SettingSchema kPumpSchema[] = {
+         SCHEMA_FLOAT(PumpValues, flow,    "Flow [l/min]", 1.5f, 0.1f),
+         SCHEMA_INT  (PumpValues, cycles,  "Cycles",       10),
+         SCHEMA_BOOL (PumpValues, enabled, "Enabled",      true),
+     };
+     SchemaSettingsBlock<PumpValues> pump("pump", "/pump", kPumpSchema);
+     ...
+     if (pump.values().enabled) ...
+
+   Supported field types: float, int32_t, bool.
+   =========================================================== */
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include "WebSettings.h"
+
+struct SettingSchema {
+    const char* key;        // HTML name= / NVS key
+    const char* label;      // human text
+    uint8_t     type;       // SettingBase::TYPE_FLOAT / TYPE_INT / TYPE_BOOL
+    uint8_t     precision;  // decimals shown for floats
+    uint16_t    offset;     // offsetof(Values, field)
+    float       step;
+    double      defVal;     // double holds every int32_t exactly
+};
+
+/* same rule as SettingBase::setPrecisionFromStep, evaluated at compile time */
+constexpr float   schemaAbs_(float x)       { return x < 0 ? -x : x; }
+constexpr float   schemaRoundDist_(float x) { return schemaAbs_(x - (float)(long long)(x + (x < 0 ? -0.5f : 0.5f))); }
+constexpr uint8_t schemaPrecision_(float x, uint8_t prec = 0) {
+    return (prec >= 9 || schemaRoundDist_(x) <= 1e-6f) ? prec : schemaPrecision_(x * 10.0f, prec + 1);
+}
+
+/* offset of a field, with a compile-time check of its type */
+template<typename Field, typename Expected>
+constexpr uint16_t schemaOffset_(size_t off) {
+    static_assert(std::is_same<Field, Expected>::value, "schema entry type does not match the struct field");
+    return (uint16_t)off;
+}
+#define SCHEMA_FIELD_TYPE_(VALUES, FIELD) \
+    std::remove_reference<decltype(((VALUES*)nullptr)->FIELD)>::type
+
+#define SCHEMA_FLOAT(VALUES, FIELD, LABEL, DEFAULT_VAL, STEP) \
+    { #FIELD, LABEL, SettingBase::TYPE_FLOAT, schemaPrecision_(STEP), \
+      schemaOffset_<SCHEMA_FIELD_TYPE_(VALUES, FIELD), float>(offsetof(VALUES, FIELD)), STEP, (double)(DEFAULT_VAL) }
+#define SCHEMA_INT(VALUES, FIELD, LABEL, DEFAULT_VAL) \
+    { #FIELD, LABEL, SettingBase::TYPE_INT, 0, \
+      schemaOffset_<SCHEMA_FIELD_TYPE_(VALUES, FIELD), int32_t>(offsetof(VALUES, FIELD)), 1.0f, (double)(DEFAULT_VAL) }
+#define SCHEMA_BOOL(VALUES, FIELD, LABEL, DEFAULT_VAL) \
+    { #FIELD, LABEL, SettingBase::TYPE_BOOL, 0, \
+      schemaOffset_<SCHEMA_FIELD_TYPE_(VALUES, FIELD), bool>(offsetof(VALUES, FIELD)), 1.0f, (DEFAULT_VAL) ? 1.0 : 0.0 }
+
+/*------------------------------------------------------------*/
+/*  Block backed by a schema table and a values struct        */
+/*------------------------------------------------------------*/
+template<class Values>
+class SchemaSettingsBlock : public SettingsBlockBase {
+public:
+    template<size_t N>
+    SchemaSettingsBlock(const char* nvs, const char* url, const SettingSchema (&schema)[N])
+      : SettingsBlockBase(nvs, url), schema_(schema), count_(N)
+    {
+        static_assert(std::is_trivially_copyable<Values>::value, "Values must be a plain struct");
+        resetToDefaults();
+    }
+
+    /* POSTs write these on the web task: other tasks read or change them
+       under a SettingsBlockBase::Guard, or through a SettingsSnapshot */
+    Values&       values()       { return values_; }
+    const Values& values() const { return values_; }
+
+    void resetToDefaults() {
+        for (size_t i = 0; i < count_; ++i) {
+            const SettingSchema& e = schema_[i];
+            switch (e.type) {
+                case SettingBase::TYPE_FLOAT: field_<float>(values_, e)   = (float)e.defVal;   break;
+                case SettingBase::TYPE_INT:   field_<int32_t>(values_, e) = (int32_t)e.defVal; break;
+                default:                      field_<bool>(values_, e)    = e.defVal != 0.0;   break;
+            }
+        }
+        stored_ = values_;
+    }
+
+protected:
+    void loadSettings_(Preferences& p) override {
+        for (size_t i = 0; i < count_; ++i) {
+            const SettingSchema& e = schema_[i];
+            switch (e.type) {
+                case SettingBase::TYPE_FLOAT: { float& v = field_<float>(values_, e);   v = p.getFloat(e.key, v); break; }
+                case SettingBase::TYPE_INT:   { int32_t& v = field_<int32_t>(values_, e); v = p.getInt(e.key, v); break; }
+                default:                      { bool& v = field_<bool>(values_, e);     v = p.getBool(e.key, v);  break; }
+            }
+        }
+        stored_ = values_;
+    }
+
+    /* dirty tracking: compares each field against the copy last loaded/saved */
+    size_t saveSettings_(Preferences& p, bool all, size_t& skipped) override {
+        size_t writes = 0;
+        for (size_t i = 0; i < count_; ++i) {
+            const SettingSchema& e = schema_[i];
+            const size_t sz = fieldSize_(e);
+            if (!all && memcmp(bytes_(values_) + e.offset, bytes_(stored_) + e.offset, sz) == 0) {
+                ++skipped;
+                continue;
+            }
+            switch (e.type) {
+                case SettingBase::TYPE_FLOAT: p.putFloat(e.key, field_<float>(values_, e));   break;
+                case SettingBase::TYPE_INT:   p.putInt  (e.key, field_<int32_t>(values_, e)); break;
+                default:                      p.putBool (e.key, field_<bool>(values_, e));    break;
+            }
+            memcpy(bytes_(stored_) + e.offset, bytes_(values_) + e.offset, sz);
+            ++writes;
+        }
+        return writes;
+    }
+
+    /* the values are copied under the lock and written from the copy:
+       'w' may flush to a slow client */
+    void writeInputs_(ChunkedWriter& w) const override {
+        Values v;
+        { Guard g(*this); v = values_; }
+        for (size_t i = 0; i < count_; ++i) {
+            const SettingSchema& e = schema_[i];
+            w.write(e.label);
+            w.write(F(": "));
+            if (e.type == SettingBase::TYPE_BOOL) {
+                w.write(F("<input type='checkbox' name='"));
+                w.writeFieldName(e.key);
+                w.write(field_<bool>(v, e) ? F("' value='1' checked >\n") : F("' value='1' >\n"));
+            } else {
+                w.write(F("<input type='text' inputmode='decimal' name='"));
+                w.writeFieldName(e.key);
+                w.write(F("' value='"));
+                writeNumber_(w, v, e);
+                w.write(F("'>\n"));
+            }
+            w.write(F("<br>\n"));
+        }
+    }
+
+    void writeJSONValues_(JsonWriter& j) const override {
+        static const char* const names[] = { "float", "int", "bool" };
+        Values v;
+        { Guard g(*this); v = values_; }
+        for (size_t i = 0; i < count_; ++i) {
+            const SettingSchema& e = schema_[i];
+            j.key(e.key).beginObject().member("type", names[std::min<uint8_t>(e.type, SettingBase::TYPE_BOOL)]).key("value");
+            if      (e.type == SettingBase::TYPE_BOOL)  j.value(field_<bool>(v, e));
+            else if (e.type == SettingBase::TYPE_FLOAT) j.value(field_<float>(v, e), e.precision);
+            else                                        j.value(field_<int32_t>(v, e));
+            j.endObject();
+        }
+    }
+
+    bool hasKey_(const char* key) const override {
+        for (size_t i = 0; i < count_; ++i) {
+            if (strcmp(schema_[i].key, key) == 0) return true;
+        }
+        return false;
+    }
+
+    void applyArgs_(const SettingsArgs& args, std::vector<const char*>& changed) override {
+        for (size_t i = 0; i < count_; ++i) {
+            const SettingSchema& e = schema_[i];
+            const String* raw = args.find(e.key);
+            uint8_t old[sizeof(float)];
+            memcpy(old, bytes_(values_) + e.offset, fieldSize_(e));
+            switch (e.type) {
+                case SettingBase::TYPE_FLOAT: if (raw) field_<float>(values_, e)   = raw->toFloat();        break;
+                case SettingBase::TYPE_INT:   if (raw) field_<int32_t>(values_, e) = (int32_t)raw->toInt(); break;
+                default:
+                    if (raw) field_<bool>(values_, e) = (*raw == "1" || *raw == "true" || *raw == "on");
+                    else if (!args.partial()) field_<bool>(values_, e) = false;   // unchecked checkbox
+                    break;
+            }
+            if (memcmp(old, bytes_(values_) + e.offset, fieldSize_(e)) != 0) changed.push_back(e.key);
+        }
+    }
+
+private:
+    const SettingSchema* schema_;   // flash
+    size_t               count_;
+    Values               values_{};
+    Values               stored_{}; // last values loaded from / written to NVS
+
+    static uint8_t*       bytes_(Values& v)       { return reinterpret_cast<uint8_t*>(&v); }
+    static const uint8_t* bytes_(const Values& v) { return reinterpret_cast<const uint8_t*>(&v); }
+
+    template<typename F>
+    static F& field_(Values& v, const SettingSchema& e) { return *reinterpret_cast<F*>(bytes_(v) + e.offset); }
+    template<typename F>
+    static const F& field_(const Values& v, const SettingSchema& e) { return *reinterpret_cast<const F*>(bytes_(v) + e.offset); }
+
+    static size_t fieldSize_(const SettingSchema& e) {
+        return e.type == SettingBase::TYPE_BOOL ? sizeof(bool) : 4;
+    }
+
+    static void writeNumber_(ChunkedWriter& w, const Values& v, const SettingSchema& e) {
+        if (e.type == SettingBase::TYPE_FLOAT) w.writeFloat(field_<float>(v, e), e.precision);
+        else                                   w.writeInt(field_<int32_t>(v, e));
+    }
+};
@@ -2,174 +2,83 @@
 #include <WebLog.h>
 #include <TimeManager.h>
 #include <ESP.h>
+#include "JsonWriter.h"
+#include "StaticAssets.h"
 
 //----------------------------------------------------------------------------
 // JSON status
 //----------------------------------------------------------------------------
+void WebStatus::writeSystemStatus(ChunkedWriter& w, bool cbor) {
+  JsonWriter(w, cbor ? JsonWriter::Format::Cbor : JsonWriter::Format::Json).beginObject()
+    .member("heap",      (uint32_t)(ESP.getFreeHeap() / 1024))
+    .member("maxAlloc",  (uint32_t)(ESP.getMaxAllocHeap() / 1024))
+    .member("heapTotal", (uint32_t)(ESP.getHeapSize() / 1024))
+    .key("tempC").value(temperatureRead(), 1)
+    .endObject();
+}
+
 String WebStatus::getSystemStatus() {
-  char buf[128];
-  snprintf(buf, sizeof(buf),
-    "{\"heap\":%u,\"maxAlloc\":%u,\"heapTotal\":%u,\"tempC\":%.1f}",
-    ESP.getFreeHeap() / 1024,
-    ESP.getMaxAllocHeap() / 1024,
-    ESP.getHeapSize() / 1024,
-    temperatureRead()
-  );
-  return String(buf);
+  String json;
+  StringChunkWriter w(json);
+  writeSystemStatus(w);
+  w.flush();
+  return json;
 }
 
 //----------------------------------------------------------------------------
 // Log text
 //----------------------------------------------------------------------------
-String WebStatus::createLogText() {
-  String txt;
+void WebStatus::writeLogText(ChunkedWriter& w) {
   auto msgs = webLog.getLogMessages();
   auto ts   = webLog.getLogTimestamps();
 
   for (size_t i = 0; i < msgs.size(); ++i) {
-    txt += "<li>"
-        + TimeManager::formattedDateAndTime(ts[i])
-        + ": " + msgs[i]
-        + "</li>\n";
+    w.write(F("<li>"));
+    w.write(TimeManager::formattedDateAndTime(ts[i]));
+    w.write(F(": "));
+    w.write(msgs[i]);
+    w.write(F("</li>\n"));
   }
+}
 
+void WebStatus::writeLogTextSince(ChunkedWriter& w, uint32_t since) {
+  uint32_t oldest = 0;
+  const auto entries = webLog.getLogEntriesSince(since, oldest);
+
+  for (size_t i = 0; i < entries.size(); ++i) {
+    w.write(F("<li data-seq=\""));
+    w.writeUInt(entries[i].seq);
+    if (i == 0) {
+      w.write(F("\" data-first=\""));
+      w.writeUInt(oldest);
+    }
+    w.write(F("\">"));
+    w.write(TimeManager::formattedDateAndTime(entries[i].timestamp));
+    w.write(F(": "));
+    w.write(entries[i].message);
+    w.write(F("</li>\n"));
+  }
+}
+
+uint32_t WebStatus::logVersion() {
+  return webLog.version();
+}
+
+String WebStatus::createLogText() {
+  String txt;
+  StringChunkWriter w(txt);
+  writeLogText(w);
+  w.flush();
   return txt;
 }
 
 //----------------------------------------------------------------------------
-// HTML / CSS / JavaScript
+// HTML
 //----------------------------------------------------------------------------
+// markup only: styles and script are /static/status.css and /static/status.js
+// (assets/, see StaticAssets.h), which pick up the paths from the data- attributes
 static const char STATUS_FRAGMENT[] PROGMEM = R"rawliteral(
-<style>
-  body {
-    font-family: Arial, sans-serif;
-  }
-
-  .status-section {
-    display: flex;
-    flex-wrap: wrap;
-    justify-content: center;
-    gap: 12px;
-    margin-bottom: 20px;
-  }
-
-  .status-wrapper {
-    width: 260px;
-    max-width: 100%;
-    font-family: sans-serif;
-    font-size: 12px;
-    margin: 4px 0;
-  }
-
-  .status-row {
-    display: flex;
-    justify-content: space-between;
-    align-items: center;
-    margin-bottom: 2px;
-  }
-
-  .status-bar-container {
-    position: relative;
-    width: 100%;
-    height: 16px;
-    background: #ddd;
-    border-radius: 4px;
-    overflow: hidden;
-  }
-
-  .status-bar-container .fill {
-    height: 100%;
-    width: 0%;
-    background: #777;
-    transition: width 0.5s, background 0.5s;
-  }
-
-  #logContainer {
-    background-color: #f9f9f9;
-    border: 1px solid #ccc;
-    padding: 10px;
-    height: 300px;
-    overflow-y: auto;
-    white-space: pre-wrap;
-    font-size: 12px;
-  }
-</style>
-
-<script>
-  function clamp(v, lo, hi) {
-    return Math.min(hi, Math.max(lo, v));
-  }
-
-  function percentColor(pct) {
-    if (pct >= 60) return '#4caf50';
-    if (pct >= 30) return '#ff9800';
-    return '#f44336';
-  }
-
-  function tempColor(tempC) {
-    if (tempC < 0)  return '#777';
-    if (tempC < 55) return '#4caf50';
-    if (tempC < 70) return '#8bc34a';
-    if (tempC < 85) return '#ff9800';
-    return '#f44336';
-  }
-
-  function setBar(id, pct, color) {
-    const bar = document.getElementById(id);
-    if (!bar) return;
-    bar.style.width = clamp(pct, 0, 100) + '%';
-    bar.style.background = color;
-  }
-
-  function updateStatus(statusPath) {
-    fetch(statusPath)
-      .then(r => r.json())
-      .then(d => {
-        const heapTotal = Math.max(1, parseFloat(d.heapTotal));
-
-        const heapPct = clamp(parseFloat(d.heap) / heapTotal * 100, 0, 100);
-        const maxAllocPct = clamp(parseFloat(d.maxAlloc) / heapTotal * 100, 0, 100);
-
-        const tempC = parseFloat(d.tempC);
-        const tempPct = clamp((clamp(tempC, 20, 100) - 20) / 80 * 100, 0, 100);
-
-        setBar('heapBar', heapPct, percentColor(heapPct));
-        setBar('maxAllocBar', maxAllocPct, percentColor(maxAllocPct));
-        setBar('tempBar', tempPct, tempColor(tempC));
-
-        document.getElementById('heapVal').innerText =
-          d.heap + ' k / ' + heapPct.toFixed(0) + '%';
-
-        document.getElementById('maxAllocVal').innerText =
-          d.maxAlloc + ' k / ' + maxAllocPct.toFixed(0) + '%';
-
-        document.getElementById('tempVal').innerText =
-          tempC.toFixed(1) + ' C';
-      })
-      .catch(e => {});
-  }
-
-  function updateLog(logPath) {
-    fetch(logPath)
-      .then(r => r.text())
-      .then(txt => {
-        const c = document.getElementById('logContainer');
-        if (!c) return;
-        c.innerHTML = txt;
-        c.scrollTop = c.scrollHeight;
-      })
-      .catch(e => {});
-  }
-
-  function initStatus(sPath, lPath) {
-    updateStatus(sPath);
-    updateLog(lPath);
-    setInterval(() => updateStatus(sPath), 5000);
-    setInterval(() => updateLog(lPath), 5000);
-  }
-</script>
-
-<div class="status-section">
+<div class="status-section" data-status-path="{{STATUS_PATH}}" data-log-path="{{LOG_PATH}}">
   <div class="status-wrapper">
     <div class="status-row">
       <span>Free Heap</span>
@@ -202,18 +111,37 @@ static const char STATUS_FRAGMENT[] PROGMEM = R"rawliteral(
 </div>
 
 <div id="logContainer"></div>
-
-<script>
-  initStatus('{{STATUS_PATH}}', '{{LOG_PATH}}');
-</script>
 )rawliteral";
 
 
+void WebStatus::writeSystemStatHtmlFragment(ChunkedWriter& w, const char* statusPath, const char* logPath) {
+  w.write(F("<link rel='stylesheet' href='"));
+  StaticAssets::writeVersionedUrl(w, StaticAssets::statusCss);
+  w.write(F("'>\n<script src='"));
+  StaticAssets::writeVersionedUrl(w, StaticAssets::statusJs);
+  w.write(F("'></script>\n"));
+
+  // copy straight from flash, substituting the placeholders on the way
+  static const char kStatus[] = "{{STATUS_PATH}}";
+  static const char kLog[]    = "{{LOG_PATH}}";
+  const char* run = STATUS_FRAGMENT;
+  while (const char* p = strstr(run, "{{")) {
+    const char* value = nullptr;
+    size_t      skip  = 2;
+    if      (!strncmp(p, kStatus, sizeof(kStatus) - 1)) { value = statusPath; skip = sizeof(kStatus) - 1; }
+    else if (!strncmp(p, kLog,    sizeof(kLog) - 1))    { value = logPath;    skip = sizeof(kLog) - 1; }
+    w.write(run, (size_t)(p - run) + (value ? 0 : skip));
+    if (value) w.write(value);
+    run = p + skip;
+  }
+  w.write(run);
+}
+
 String WebStatus::createSystemStatHtmlFragment(const char* statusPath, const char* logPath) {
   String frag;
   frag.reserve(sizeof(STATUS_FRAGMENT));
-  frag = FPSTR(STATUS_FRAGMENT);
-  frag.replace("{{STATUS_PATH}}", statusPath);
-  frag.replace("{{LOG_PATH}}", logPath);
+  StringChunkWriter w(frag);
+  writeSystemStatHtmlFragment(w, statusPath, logPath);
+  w.flush();
   return frag;
 }
\ No newline at end of file
@@ -1,13 +1,25 @@
 #pragma once
 #include <Arduino.h>
 
+class ChunkedWriter;
+
 namespace WebStatus {
-  // JSON + Log text
+  // JSON (or CBOR) + Log text, written into a (chunked) sink or returned as String
+  void writeSystemStatus(ChunkedWriter& w, bool cbor = false);
+  void writeLogText(ChunkedWriter& w);
+  uint32_t logVersion();   // changes whenever the log text does
+  // for the "log" event: only the entries changed after logVersion()
+  // 'since' (0: all); each <li> carries data-seq, the first also data-first
+  // (oldest entry held), so status.js can merge them into what it shows
+  void writeLogTextSince(ChunkedWriter& w, uint32_t since);
   String getSystemStatus();
   String createLogText();
 
   // HTML fragment: status bars + live-updating log
   //    statusPath, logPath: which URLs to fetch for JSON and log
+  void writeSystemStatHtmlFragment(ChunkedWriter& w,
+                                   const char* statusPath = "/status",
+                                   const char* logPath    = "/log");
   String createSystemStatHtmlFragment(const char* statusPath = "/status",
                                       const char* logPath    = "/log");
 }
\ No newline at end of file
@@ -12,24 +12,15 @@ public:
         : WebDisplayBase(id, updateIntervalSecs),
           wifi_(wifi) {}
 
-    String routeText() const override {
+    void writeValue(JsonWriter& j) const override {
         const int32_t rssi = wifi_.getSignalStrength();
-        const String summary = wifi_.getConnectionSummary();
-
-        String json;
-        json.reserve(id_.length() + summary.length() + 160);
-        json += F("{\"id\":\"");
-        json += id();
-        json += F("\",\"value\":");
-        json += String(rssi);
-        json += F(",\"level\":\"");
-        json += levelText(rssi);
-        json += F("\",\"percent\":");
-        json += String(rssiToPercent(rssi));
-        json += F(",\"summary\":\"");
-        json += jsonEscape(summary);
-        json += F("\"}");
-        return json;
+        j.beginObject()
+            .member("id", id_)
+            .member("value", rssi)
+            .member("level", levelText(rssi))
+            .member("percent", rssiToPercent(rssi))
+            .member("summary", wifi_.getConnectionSummary())
+            .endObject();
     }
 
     String createHtmlFragment() const override {
@@ -37,74 +28,32 @@ public:
         const int pct = rssiToPercent(rssi);
         const String summary = wifi_.getConnectionSummary();
 
+        // styled by .bwi-rssi in /static/bwi.css, updated by the shared runtime
         String html;
-        html.reserve(2400 + summary.length());
+        html.reserve(360 + summary.length());
 
-        html += "<div id=\""; html += id(); html += "_container\" "
-                "style=\"width:520px;max-width:100%;font-family:sans-serif;"
-                "font-size:12px;margin:4px 0;\">\n";
+        html += "<div id=\""; html += id(); html += "_container\" class=\"bwi-rssi\"";
+        appendBindAttrs(html, "rssi");
+        html += ">\n";
 
-        html += "  <div style=\"display:flex;justify-content:space-between;"
-                "align-items:center;margin-bottom:2px;\">\n";
-        html += "    <span>WiFi RSSI</span>\n";
-        html += "    <span id=\""; html += id(); html += "_text\">";
+        html += "  <div class=\"hdr\"><span>WiFi RSSI</span><span class=\"txt\">";
         html += String(rssi);
         html += " dBm / ";
         html += levelText(rssi);
-        html += "</span>\n";
-        html += "  </div>\n";
-
-        html += "  <div style=\"position:relative;width:100%;height:16px;"
-                "background:#ddd;border-radius:4px;overflow:hidden;\">\n";
+        html += "</span></div>\n";
 
-        html += "    <div id=\""; html += id(); html += "_bar\" "
-                "style=\"height:100%;width:";
+        html += "  <div class=\"track\"><div class=\"fill\" style=\"width:";
         html += String(pct);
         html += "%;background:";
         html += colorFor(rssi);
-        html += ";\"></div>\n";
+        html += ";\"></div></div>\n";
 
-        html += "  </div>\n";
-
-        html += "  <div id=\""; html += id(); html += "_summary\" "
-                "style=\"margin-top:3px;color:#555;white-space:normal;"
-                "overflow-wrap:anywhere;line-height:1.25;\">";
+        html += "  <div class=\"sum\">";
         html += htmlEscape(summary);
         html += "</div>\n";
 
         html += "</div>\n";
 
-        html += "<script>\n"
-                "(function(){\n"
-                "  const bar=document.getElementById('"; html += id(); html += "_bar');\n";
-        html += "  const txt=document.getElementById('"; html += id(); html += "_text');\n";
-        html += "  const sum=document.getElementById('"; html += id(); html += "_summary');\n";
-        html += "  function colorFor(rssi){\n"
-                "    if(rssi <= -126) return '#777';\n"
-                "    if(rssi >= -60) return '#4caf50';\n"
-                "    if(rssi >= -70) return '#8bc34a';\n"
-                "    if(rssi >= -80) return '#ff9800';\n"
-                "    return '#f44336';\n"
-                "  }\n"
-                "  async function poll(){\n"
-                "    try{\n"
-                "      const r=await fetch('"; html += handle(); html += "');\n";
-        html += "      if(r.ok){\n"
-                "        const d=await r.json();\n"
-                "        const v=parseInt(d.value);\n"
-                "        const pct=Math.min(100,Math.max(0,parseInt(d.percent)));\n"
-                "        bar.style.width=pct+'%';\n"
-                "        bar.style.background=colorFor(v);\n"
-                "        txt.textContent=(v <= -126) ? 'disconnected' : (v + ' dBm / ' + d.level);\n"
-                "        if(sum && typeof d.summary === 'string') sum.textContent=d.summary;\n"
-                "      }\n"
-                "    }catch(e){}\n"
-                "  }\n"
-                "  poll();\n"
-                "  setInterval(poll,"; html += String(updateInterval_ * 1000); html += ");\n"
-                "})();\n"
-                "</script>\n";
-
         return html;
     }
 
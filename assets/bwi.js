@@ -0,0 +1,128 @@
+(function(){
+  const subs={}; let ms=0, timer=null, live=false, seq=null, es=null;
+  const sse=document.currentScript && document.currentScript.dataset.sse;
+  function dispatch(all){ for(const id in all){ if(subs[id]) subs[id](all[id]); } }
+  async function tick(){
+    if(live) return;
+    try{
+      const r=await fetch('/displays.json'+(seq?'?since='+seq:''));
+      if(!r.ok) return;
+      dispatch(await r.json());
+      seq=r.headers.get('X-Display-Seq');
+    }catch(e){}
+  }
+  if(sse && window.EventSource){
+    es=new EventSource('/events');
+    es.onopen=()=>{ live=true; };
+    es.onerror=()=>{ live=false; };
+    es.onmessage=(e)=>{ try{ dispatch(JSON.parse(e.data)); }catch(x){} };
+  }
+  // sparklines: all of them from one /histories.json, or the "history" event
+  const sparks={}; let sparkMs=0, sparkTimer=null;
+  function drawSparks(all){ for(const id in all){ if(sparks[id]) sparks[id](all[id]); } }
+  async function sparkTick(first){
+    if(live && !first) return;
+    try{ const r=await fetch('/histories.json'); if(r.ok) drawSparks(await r.json()); }catch(e){}
+  }
+  function addSpark(id,interval,draw){
+    sparks[id]=draw;
+    if(sparkMs && interval>=sparkMs) return;
+    sparkMs=interval;
+    if(sparkTimer) clearInterval(sparkTimer);
+    sparkTimer=setInterval(sparkTick,sparkMs);
+  }
+  if(es) es.addEventListener('history',e=>{ try{ drawSparks(JSON.parse(e.data)); }catch(x){} });
+  // named events on the same stream (e.g. the status panel); false without one
+  window.bwiOn=function(name,fn){
+    if(!es) return false;
+    es.addEventListener(name,e=>fn(e.data));
+    return true;
+  };
+  window.bwiLive=()=>live;
+  window.bwiRegister=function(id,interval,apply){
+    subs[id]=apply;
+    if(ms && interval>=ms) return;
+    ms=interval;
+    if(timer) clearInterval(timer);
+    timer=setInterval(tick,ms);
+  };
+  function rssiColor(v){
+    if(v<=-126) return '#777';
+    if(v>=-60) return '#4caf50';
+    if(v>=-70) return '#8bc34a';
+    if(v>=-80) return '#ff9800';
+    return '#f44336';
+  }
+  // kind -> function(el) returning the apply(d) callback (null: not polled)
+  const kinds={
+    text(el){ return d=>{ el.textContent=d.value; }; },
+    led(el){
+      const r=el.children[0], g=el.children[1];
+      return d=>{
+        if(d.value){ r.className='led off'; g.className='led on green'; }
+        else { r.className='led on red'; g.className='led off'; }
+      };
+    },
+    bar(el){
+      const max=parseFloat(el.dataset.max), unit=el.dataset.unit||'';
+      return d=>{
+        const v=parseFloat(d.value);
+        el.style.width=Math.min(100,Math.max(0,(v/max)*100))+'%';
+        el.textContent=v.toFixed(1)+unit;
+      };
+    },
+    rssi(el){
+      const bar=el.querySelector('.fill'), txt=el.querySelector('.txt'), sum=el.querySelector('.sum');
+      return d=>{
+        const v=parseInt(d.value);
+        bar.style.width=Math.min(100,Math.max(0,parseInt(d.percent)))+'%';
+        bar.style.background=rssiColor(v);
+        txt.textContent=(v<=-126)?'disconnected':(v+' dBm / '+d.level);
+        if(sum && typeof d.summary==='string') sum.textContent=d.summary;
+      };
+    },
+    spark(el){
+      const ctx=el.getContext('2d');
+      function draw(h){
+        const W=el.width, H=el.height, n=h.avg.length;
+        let lo=Infinity, hi=-Infinity;
+        for(let i=0;i<n;i++){ if(h.min[i]!==null){ lo=Math.min(lo,h.min[i]); hi=Math.max(hi,h.max[i]); } }
+        ctx.clearRect(0,0,W,H);
+        if(lo>hi) return;
+        if(hi===lo){ hi+=1; lo-=1; }
+        const x=i=>n>1?i*(W-1)/(n-1):W/2, y=v=>H-2-(v-lo)*(H-4)/(hi-lo);
+        ctx.fillStyle='rgba(76,175,80,.25)';
+        for(let i=0;i<n;i++){ if(h.min[i]!==null) ctx.fillRect(x(i)-1,y(h.max[i]),2,Math.max(1,y(h.min[i])-y(h.max[i]))); }
+        ctx.strokeStyle='#4caf50'; ctx.beginPath(); let pen=false;
+        for(let i=0;i<n;i++){
+          if(h.avg[i]===null){ pen=false; continue; }
+          if(pen) ctx.lineTo(x(i),y(h.avg[i])); else ctx.moveTo(x(i),y(h.avg[i]));
+          pen=true;
+        }
+        ctx.stroke();
+      }
+      addSpark(el.dataset.id,parseInt(el.dataset.iv),draw);
+      return null;
+    },
+    button(el){
+      const cd=parseInt(el.dataset.cooldown||'0'); let last=0;
+      el.addEventListener('click',async()=>{
+        const now=Date.now();
+        if(cd && now-last<cd) return;
+        last=now; el.disabled=true;
+        try{ await fetch(el.dataset.src); }catch(e){}
+        if(cd) setTimeout(()=>el.disabled=false,cd); else el.disabled=false;
+      });
+      return null;
+    }
+  };
+  document.addEventListener('DOMContentLoaded',()=>{
+    document.querySelectorAll('[data-bwi]').forEach(el=>{
+      const k=kinds[el.dataset.bwi];
+      const apply=k && k(el);
+      if(apply && el.dataset.iv) bwiRegister(el.dataset.id,parseInt(el.dataset.iv),apply);
+    });
+    tick();
+    if(sparkMs) sparkTick(true);   // the stream may have sent its first one already
+  });
+})();
@@ -0,0 +1,108 @@
+function clamp(v, lo, hi) {
+  return Math.min(hi, Math.max(lo, v));
+}
+
+function percentColor(pct) {
+  if (pct >= 60) return '#4caf50';
+  if (pct >= 30) return '#ff9800';
+  return '#f44336';
+}
+
+function tempColor(tempC) {
+  if (tempC < 0)  return '#777';
+  if (tempC < 55) return '#4caf50';
+  if (tempC < 70) return '#8bc34a';
+  if (tempC < 85) return '#ff9800';
+  return '#f44336';
+}
+
+function setBar(id, pct, color) {
+  const bar = document.getElementById(id);
+  if (!bar) return;
+  bar.style.width = clamp(pct, 0, 100) + '%';
+  bar.style.background = color;
+}
+
+function applyStatus(d) {
+  const heapTotal = Math.max(1, parseFloat(d.heapTotal));
+
+  const heapPct = clamp(parseFloat(d.heap) / heapTotal * 100, 0, 100);
+  const maxAllocPct = clamp(parseFloat(d.maxAlloc) / heapTotal * 100, 0, 100);
+
+  const tempC = parseFloat(d.tempC);
+  const tempPct = clamp((clamp(tempC, 20, 100) - 20) / 80 * 100, 0, 100);
+
+  setBar('heapBar', heapPct, percentColor(heapPct));
+  setBar('maxAllocBar', maxAllocPct, percentColor(maxAllocPct));
+  setBar('tempBar', tempPct, tempColor(tempC));
+
+  document.getElementById('heapVal').innerText =
+    d.heap + ' k / ' + heapPct.toFixed(0) + '%';
+
+  document.getElementById('maxAllocVal').innerText =
+    d.maxAlloc + ' k / ' + maxAllocPct.toFixed(0) + '%';
+
+  document.getElementById('tempVal').innerText =
+    tempC.toFixed(1) + ' C';
+}
+
+function applyLog(txt) {
+  const c = document.getElementById('logContainer');
+  if (!c) return;
+  c.innerHTML = txt;
+  c.scrollTop = c.scrollHeight;
+}
+
+// "log" events carry only the entries changed since the previous one: an
+// entry replaces the shown one with the same data-seq and everything after
+// it, entries older than data-first have left the device's ring
+function mergeLog(txt) {
+  const c = document.getElementById('logContainer');
+  if (!c) return;
+  const t = document.createElement('template');
+  t.innerHTML = txt;
+  const head = t.content.querySelector('li[data-seq]');
+  if (!head) { c.innerHTML = ''; return; }   // the log is empty
+  const from = +head.dataset.seq, first = +head.dataset.first;
+  Array.from(c.children).forEach(li => {
+    const s = +li.dataset.seq;
+    if (!(s >= first && s < from)) li.remove();
+  });
+  c.appendChild(t.content);
+  c.scrollTop = c.scrollHeight;
+}
+
+function updateStatus(statusPath) {
+  fetch(statusPath)
+    .then(r => r.json())
+    .then(applyStatus)
+    .catch(e => {});
+}
+
+function updateLog(logPath) {
+  fetch(logPath)
+    .then(r => r.text())
+    .then(applyLog)
+    .catch(e => {});
+}
+
+function initStatus(sPath, lPath) {
+  // with the display event stream (bwi.js, data-sse) open, status and log
+  // arrive on it as "status" / "log" events; polling covers the gaps
+  if (window.bwiOn) {
+    bwiOn('status', t => { try { applyStatus(JSON.parse(t)); } catch (e) {} });
+    bwiOn('log', mergeLog);
+  }
+  const live = () => window.bwiLive && bwiLive();
+  updateStatus(sPath);
+  updateLog(lPath);
+  setInterval(() => { if (!live()) updateStatus(sPath); }, 5000);
+  setInterval(() => { if (!live()) updateLog(lPath); }, 5000);
+}
+
+// the fragment carries its endpoints: <div class="status-section" data-status-path=.. data-log-path=..>
+document.addEventListener('DOMContentLoaded', () => {
+  document.querySelectorAll('[data-status-path]').forEach(el => {
+    initStatus(el.dataset.statusPath, el.dataset.logPath);
+  });
+});
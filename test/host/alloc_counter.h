@@ -0,0 +1,53 @@
+// -----------------------------------------------------------------------------
+// alloc_counter.h  – counts heap use of a host program (include it in exactly
+// one translation unit: it replaces the global operator new / delete)
+// -----------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace AllocCounter {
+    struct State {
+        std::atomic<long long> live{0};     // bytes currently allocated
+        std::atomic<long long> peak{0};     // highest 'live' since reset()
+        std::atomic<long long> count{0};    // allocations since reset()
+    };
+    inline State& state() { static State s; return s; }
+
+    /** starts a measurement at the current heap level */
+    inline void reset() {
+        state().peak  = state().live.load();
+        state().count = 0;
+    }
+    inline long long live()  { return state().live; }
+    inline long long peak()  { return state().peak; }
+    inline long long count() { return state().count; }
+}
+
+// each block carries its size in front of the payload
+static inline void* allocCounted_(std::size_t n) {
+    auto& s = AllocCounter::state();
+    std::size_t* p = static_cast<std::size_t*>(std::malloc(n + sizeof(std::max_align_t)));
+    if (!p) throw std::bad_alloc();
+    *p = n;
+    const long long now = s.live += (long long)n;
+    long long peak = s.peak;
+    while (now > peak && !s.peak.compare_exchange_weak(peak, now)) {}
+    ++s.count;
+    return reinterpret_cast<char*>(p) + sizeof(std::max_align_t);
+}
+static inline void freeCounted_(void* q) {
+    if (!q) return;
+    std::size_t* p = reinterpret_cast<std::size_t*>(static_cast<char*>(q) - sizeof(std::max_align_t));
+    AllocCounter::state().live -= (long long)*p;
+    std::free(p);
+}
+
+void* operator new(std::size_t n)                          { return allocCounted_(n); }
+void* operator new[](std::size_t n)                        { return allocCounted_(n); }
+void  operator delete(void* p) noexcept                    { freeCounted_(p); }
+void  operator delete[](void* p) noexcept                  { freeCounted_(p); }
+void  operator delete(void* p, std::size_t) noexcept       { freeCounted_(p); }
+void  operator delete[](void* p, std::size_t) noexcept     { freeCounted_(p); }
@@ -0,0 +1,80 @@
+// Array settings in NVS: per-element keys vs one blob per array. Counts the
+// NVS lookups / writes and entries of load(), save() and the one-time
+// migration, and times load() on the host.
+#include "WebSettings.h"
+#include <chrono>
+#include <cstdio>
+
+// five arrays, 144 elements
+struct Curves : public SettingsBlockBase {
+    Curves() : SettingsBlockBase("curves", "/curves") {}
+    DEF_SETTING_ARRAY(float,   heat, "Heating curve", 21.0f, 0.1f, 32);
+    DEF_SETTING_ARRAY(float,   cool, "Cooling curve", 24.0f, 0.1f, 32);
+    DEF_SETTING_ARRAY(float,   gain, "Gains",          1.0f, 0.01f, 32);
+    DEF_SETTING_ARRAY(int32_t, slot, "Time slots",     600,  1,    32);
+    DEF_SETTING_ARRAY(bool,    zone, "Zones",          true, 1,    16);
+
+    void setMode(SettingDynArray<float>::StorageMode m) {
+        heat.setStorageMode(m); cool.setStorageMode(m); gain.setStorageMode(m);
+        slot.setStorageMode((SettingDynArray<int32_t>::StorageMode)m);
+        zone.setStorageMode((SettingDynArray<bool>::StorageMode)m);
+    }
+    void touchAll() {
+        for (auto& v : heat.value) v += 0.5f;
+        for (auto& v : cool.value) v -= 0.5f;
+        for (auto& v : gain.value) v *= 2.0f;
+        for (auto& v : slot.value) v += 15;
+        for (size_t i = 0; i < zone.value.size(); ++i) zone.value[i] = !zone.value[i];
+    }
+};
+
+struct Row { size_t lookups, writes; };
+template <typename F>
+static Row counted(F fn) {
+    Preferences::stats() = Preferences::Stats();
+    fn();
+    return Row{Preferences::stats().lookups, Preferences::stats().writes};
+}
+
+static double loadMicros(Curves& c) {
+    const int kRounds = 2000;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRounds; ++i) c.load();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / kRounds;
+}
+
+static void run(const char* name, SettingDynArray<float>::StorageMode m) {
+    Preferences::reset();
+    Curves c;
+    c.setMode(m);
+    c.begin();
+    c.touchAll();
+    const Row save = counted([&] { c.save(); });
+    const Row load = counted([&] { c.load(); });
+    const double us = loadMicros(c);
+    printf("%-12s load %4zu lookups %7.1f us | save %4zu writes | %3zu keys %3zu entries\n",
+           name, load.lookups, us, save.writes, Preferences::keys("curves"), Preferences::entries("curves"));
+}
+
+int main() {
+    printf("5 arrays, 144 elements\n");
+    run("per-element", SettingDynArray<float>::STORAGE_PER_ELEMENT);
+    run("blob",        SettingDynArray<float>::STORAGE_BLOB);
+
+    // first boot after an update: legacy keys in NVS, blob storage in firmware
+    Preferences::reset();
+    {
+        Curves old;
+        old.setMode(SettingDynArray<float>::STORAGE_PER_ELEMENT);
+        old.begin();
+        old.touchAll();
+        old.saveAll();
+    }
+    Curves c;
+    c.setMode(SettingDynArray<float>::STORAGE_BLOB);
+    const Row first = counted([&] { c.begin(); });
+    const Row next  = counted([&] { c.load(); });
+    printf("migration    first load %zu lookups %zu writes, next load %zu lookups, %zu keys left, heat[0]=%.1f\n",
+           first.lookups, first.writes, next.lookups, Preferences::keys("curves"), c.heat[0]);
+    return 0;
+}
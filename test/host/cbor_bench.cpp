@@ -0,0 +1,55 @@
+// JSON vs CBOR for the display routes and /status: bytes per answer and host
+// time to encode one (into a stack buffer, nothing sent).
+#include "WebButton.h"
+#include "WebStatus.h"
+#include "WiFiRSSIDisplay.h"
+#include <chrono>
+#include <cstdio>
+
+static volatile size_t sink = 0;
+
+struct Sample { size_t bytes; double ns; };
+
+template <typename Fn>
+static Sample encode(Fn fn) {
+    const int kRounds = 200000;
+    char buf[CHUNKED_WRITER_BUFFER_SIZE];
+    size_t bytes = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRounds; ++i) {
+        BufferChunkWriter w(buf, sizeof(buf));
+        fn(w);
+        bytes = w.length();
+        sink = sink + bytes;
+    }
+    return { bytes, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / kRounds };
+}
+
+static void row(const char* name, const Sample& json, const Sample& cbor) {
+    printf("  %-20s %4zu B %6.0f ns | %4zu B %6.0f ns\n", name, json.bytes, json.ns, cbor.bytes, cbor.ns);
+}
+
+static void display(const char* name, const WebDisplayBase& d) {
+    row(name, encode([&](ChunkedWriter& w) { d.writeJson(w); }),
+              encode([&](ChunkedWriter& w) { d.writeCbor(w); }));
+}
+
+int main() {
+    WebDisplay<float>    temp("temp", 2, 21.5f);
+    WebDisplay<bool>     pump("pump", 2, true);
+    WebDisplay<int32_t>  count("count", 2, 123456);
+    WebBarDisplay<float> tank("tank", 5, 1000.0f, "L");
+    WiFiWrapper          wifi;
+    WiFiRSSIDisplay      rssi("rssi", wifi);
+    tank.update(734.5f);
+
+    printf("bytes and encode time per answer      JSON | CBOR\n");
+    display("WebDisplay<float>", temp);
+    display("WebDisplay<bool>", pump);
+    display("WebDisplay<int32_t>", count);
+    display("WebBarDisplay<float>", tank);
+    display("WiFiRSSIDisplay", rssi);
+    row("/status", encode([](ChunkedWriter& w) { WebStatus::writeSystemStatus(w, false); }),
+                   encode([](ChunkedWriter& w) { WebStatus::writeSystemStatus(w, true); }));
+    return 0;
+}
@@ -0,0 +1,205 @@
+// CBOR output (JsonWriter::Format::Cbor / CborTraits): golden bytes for the
+// encoding rules (shortest-form heads, float32, indefinite-length containers
+// closed by a break), and every display and /status decoded back by a small
+// RFC 8949 reader that rejects anything malformed.
+#include "WebButton.h"
+#include "WebStatus.h"
+#include "WiFiRSSIDisplay.h"
+#include <cstdio>
+#include <limits>
+
+static int failures = 0;
+
+#define EXPECT_EQ(got, want)                                                            \
+    do {                                                                                \
+        const std::string g_ = (got), w_ = (want);                                      \
+        if (g_ != w_) {                                                                 \
+            printf("FAILED %s:%d  %s\n  got  %s\n  want %s\n", __FILE__, __LINE__, #got, \
+                   g_.c_str(), w_.c_str());                                             \
+            ++failures;                                                                 \
+        }                                                                               \
+    } while (0)
+
+template <typename Fn>
+static std::string bytes(Fn fn) {
+    String out;
+    {
+        StringChunkWriter w(out);
+        fn(w);
+    }
+    return out;
+}
+
+static std::string hex(const std::string& b) {
+    std::string h;
+    char t[4];
+    for (unsigned char c : b) {
+        snprintf(t, sizeof(t), h.empty() ? "%02x" : " %02x", c);
+        h += t;
+    }
+    return h;
+}
+
+template <typename T>
+static std::string cborValue(const T& v) {
+    return hex(bytes([&](ChunkedWriter& w) { JsonWriter(w, JsonWriter::Format::Cbor).value(v); }));
+}
+
+// ---- reader: CBOR -> JSON-like text, "!error" on malformed input ------------
+struct Reader {
+    const std::string& b;
+    size_t at = 0;
+    bool   bad = false;
+
+    uint8_t byte() {
+        if (at >= b.size()) { bad = true; return 0xff; }
+        return (uint8_t)b[at++];
+    }
+    uint64_t argument(uint8_t info) {
+        if (info < 24) return info;
+        const int n = info == 24 ? 1 : info == 25 ? 2 : info == 26 ? 4 : info == 27 ? 8 : 0;
+        if (!n) { bad = true; return 0; }
+        uint64_t v = 0;
+        for (int i = 0; i < n; ++i) v = (v << 8) | byte();
+        // shortest form: a longer head than needed is not what we write
+        if ((n == 1 && v < 24) || (n > 1 && v < (1ull << (4 * n)))) bad = true;
+        return v;
+    }
+    std::string item() {
+        const uint8_t ib = byte(), major = ib >> 5, info = ib & 31;
+        char t[40];
+        switch (major) {
+            case 0: snprintf(t, sizeof(t), "%llu", (unsigned long long)argument(info)); return t;
+            case 1: snprintf(t, sizeof(t), "-%llu", (unsigned long long)argument(info) + 1); return t;
+            case 3: {
+                const uint64_t n = argument(info);
+                if (at + n > b.size()) { bad = true; return ""; }
+                std::string s = "\"" + b.substr(at, n) + "\"";
+                at += n;
+                return s;
+            }
+            case 4: case 5: {
+                if (info != 31) { bad = true; return ""; }   // we only write indefinite length
+                std::string s(1, major == 4 ? '[' : '{');
+                for (bool first = true; !bad; first = false) {
+                    if (at < b.size() && (uint8_t)b[at] == 0xff) { ++at; break; }
+                    if (!first) s += ',';
+                    if (major == 5) {
+                        if (at < b.size() && ((uint8_t)b[at] >> 5) != 3) bad = true;   // keys are text
+                        s += item() + ":";
+                    }
+                    s += item();
+                    if (at >= b.size()) bad = true;   // no break byte
+                }
+                return s + (major == 4 ? ']' : '}');
+            }
+            case 7:
+                if (ib == 0xf4) return "false";
+                if (ib == 0xf5) return "true";
+                if (ib == 0xf6) return "null";
+                if (ib == 0xfa) {
+                    uint32_t bits = 0;
+                    for (int i = 0; i < 4; ++i) bits = (bits << 8) | byte();
+                    float f;
+                    memcpy(&f, &bits, 4);
+                    snprintf(t, sizeof(t), "%.9g", f);
+                    return t;
+                }
+                if (ib == 0xfb) {
+                    uint64_t bits = 0;
+                    for (int i = 0; i < 8; ++i) bits = (bits << 8) | byte();
+                    double d;
+                    memcpy(&d, &bits, 8);
+                    snprintf(t, sizeof(t), "%.17g", d);
+                    return t;
+                }
+                bad = true;
+                return "";
+            default:
+                bad = true;
+                return "";
+        }
+    }
+};
+
+static std::string decode(const std::string& b) {
+    Reader r{b};
+    const std::string s = r.item();
+    if (r.bad || r.at != b.size()) return "!malformed: " + hex(b);
+    return s;
+}
+
+static std::string decodeDisplay(const WebDisplayBase& d) {
+    return decode(bytes([&](ChunkedWriter& w) { d.writeCbor(w); }));
+}
+
+int main() {
+    // shortest-form heads at every boundary, both signs
+    EXPECT_EQ(cborValue(0), "00");
+    EXPECT_EQ(cborValue(23), "17");
+    EXPECT_EQ(cborValue(24), "18 18");
+    EXPECT_EQ(cborValue(255), "18 ff");
+    EXPECT_EQ(cborValue(256), "19 01 00");
+    EXPECT_EQ(cborValue(65535), "19 ff ff");
+    EXPECT_EQ(cborValue(65536), "1a 00 01 00 00");
+    EXPECT_EQ(cborValue((uint32_t)4294967295u), "1a ff ff ff ff");
+    EXPECT_EQ(cborValue(-1), "20");
+    EXPECT_EQ(cborValue(-24), "37");
+    EXPECT_EQ(cborValue(-25), "38 18");
+    EXPECT_EQ(cborValue(-256), "38 ff");
+    EXPECT_EQ(cborValue(-257), "39 01 00");
+    EXPECT_EQ(cborValue(std::numeric_limits<int32_t>::min()), "3a 7f ff ff ff");
+    EXPECT_EQ(cborValue((uint8_t)200), "18 c8");
+
+    // float32, big-endian, whatever the JSON precision would be
+    EXPECT_EQ(cborValue(21.5f), "fa 41 ac 00 00");
+    EXPECT_EQ(cborValue(-0.0f), "fa 80 00 00 00");
+    EXPECT_EQ(cborValue(std::numeric_limits<float>::infinity()), "fa 7f 80 00 00");
+    EXPECT_EQ(hex(bytes([](ChunkedWriter& w) { JsonWriter(w, JsonWriter::Format::Cbor).value(0.1f, 1); })),
+              "fa 3d cc cc cd");
+
+    // simple values and text
+    EXPECT_EQ(cborValue(true), "f5");
+    EXPECT_EQ(cborValue(false), "f4");
+    EXPECT_EQ(hex(bytes([](ChunkedWriter& w) { JsonWriter(w, JsonWriter::Format::Cbor).null(); })), "f6");
+    EXPECT_EQ(cborValue("ab"), "62 61 62");
+    EXPECT_EQ(cborValue(String(std::string(23, 'x').c_str())).substr(0, 2), "77");
+    EXPECT_EQ(cborValue(String(std::string(24, 'x').c_str())).substr(0, 5), "78 18");
+
+    // containers: indefinite length, each closed by a 0xff break
+    EXPECT_EQ(hex(bytes([](ChunkedWriter& w) {
+                  JsonWriter(w, JsonWriter::Format::Cbor)
+                      .beginObject().key("a").beginArray().value(1).beginObject().endObject().endArray().endObject();
+              })),
+              "bf 61 61 9f 01 bf ff ff ff");
+
+    // a whole display answer, byte for byte
+    WebDisplay<float> temp("t", 1, 21.5f);
+    EXPECT_EQ(hex(bytes([&](ChunkedWriter& w) { temp.writeCbor(w); })),
+              "bf 62 69 64 61 74 65 76 61 6c 75 65 fa 41 ac 00 00 ff");
+
+    // every built-in answer decodes cleanly to the values the JSON carries
+    WebDisplay<String>   state("state", 1, String("heating"));
+    WebDisplay<bool>     pump("pump", 1, true);
+    WebDisplay<int32_t>  count("count", 1, -1000);
+    WebBarDisplay<float> tank("tank", 5, 1000.0f, "L");
+    WebButton            reset("reset", "Reset", [] {});
+    WiFiWrapper          wifi;
+    WiFiRSSIDisplay      rssi("rssi", wifi);
+    tank.update(734.5f);
+    EXPECT_EQ(decodeDisplay(temp),  "{\"id\":\"t\",\"value\":21.5}");
+    EXPECT_EQ(decodeDisplay(state), "{\"id\":\"state\",\"value\":\"heating\"}");
+    EXPECT_EQ(decodeDisplay(pump),  "{\"id\":\"pump\",\"value\":true}");
+    EXPECT_EQ(decodeDisplay(count), "{\"id\":\"count\",\"value\":-1000}");
+    EXPECT_EQ(decodeDisplay(tank),  "{\"id\":\"tank\",\"value\":734.5}");
+    EXPECT_EQ(decodeDisplay(reset), "{\"id\":\"reset\",\"clicks\":1}");
+    EXPECT_EQ(decodeDisplay(rssi),
+              "{\"id\":\"rssi\",\"value\":-67,\"level\":\"fair\",\"percent\":57,"
+              "\"summary\":\"hostnet, 192.168.1.42, channel 6\"}");
+    const std::string status = decode(bytes([](ChunkedWriter& w) { WebStatus::writeSystemStatus(w, true); }));
+    EXPECT_EQ(status.substr(0, 8), "{\"heap\":");
+    EXPECT_EQ(status.substr(status.find("\"tempC\"")), "\"tempC\":47.5}");
+
+    printf("%s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
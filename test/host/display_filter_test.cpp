@@ -0,0 +1,75 @@
+// UpdateFilter / FilteredValueSlot: which update() calls publish.
+#include "WebDisplay.h"
+#include <cstdio>
+#include <limits>
+
+static int failures = 0;
+
+#define EXPECT(cond)                                                   \
+    do {                                                               \
+        if (!(cond)) { printf("FAILED %s:%d  %s\n", __FILE__, __LINE__, #cond); ++failures; } \
+    } while (0)
+
+// publishes 'from' first, then reports whether 'to' is published as well
+template <typename T>
+static bool publishes(T from, T to, const UpdateFilter& f = UpdateFilter()) {
+    FilteredValueSlot<T> slot(from, f);
+    return slot.update(to, 0);
+}
+
+int main() {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+
+    // no band: every change, compared in the value's own type
+    EXPECT(publishes<uint32_t>(16777216u, 16777217u));          // equal as float
+    EXPECT(publishes<int64_t>(1LL << 53, (1LL << 53) + 1));     // equal as double
+    EXPECT(publishes<float>(1.0f, std::nextafter(1.0f, 2.0f)));
+    EXPECT(!publishes<uint32_t>(7, 7));
+    EXPECT(!publishes<float>(2.5f, 2.5f));
+    EXPECT(publishes<String>(String("a"), String("b")));
+    EXPECT(!publishes<String>(String("a"), String("a")));
+
+    // NaN: entering and leaving count, NaN -> NaN does not (with or without band)
+    EXPECT(publishes<float>(1.0f, nan));
+    EXPECT(publishes<float>(nan, 1.0f));
+    EXPECT(!publishes<float>(nan, nan));
+    EXPECT(publishes<float>(1.0f, nan, UpdateFilter(10)));
+    EXPECT(publishes<float>(nan, 1.0f, UpdateFilter(10)));
+    EXPECT(!publishes<float>(nan, nan, UpdateFilter(10)));
+    EXPECT(publishes<float>(inf, 1.0f, UpdateFilter(0, 0.5f)));  // band of inf would never let go
+    EXPECT(!publishes<float>(inf, inf, UpdateFilter(0, 0.5f)));
+
+    // absolute and relative band (the wider one applies)
+    EXPECT(!publishes<float>(20.0f, 20.4f, UpdateFilter(0.5f)));
+    EXPECT(publishes<float>(20.0f, 20.6f, UpdateFilter(0.5f)));
+    EXPECT(!publishes<float>(100.0f, 104.0f, UpdateFilter(0.5f, 0.05f)));
+    EXPECT(publishes<float>(100.0f, 106.0f, UpdateFilter(0.5f, 0.05f)));
+    EXPECT(!publishes<int32_t>(-5, -7, UpdateFilter(2)));
+    EXPECT(publishes<int32_t>(-5, -8, UpdateFilter(2)));
+    EXPECT(publishes<int32_t>(INT32_MIN, INT32_MAX, UpdateFilter(2)));    // no overflow
+    EXPECT(publishes<uint8_t>(250, 5, UpdateFilter(100)));
+    EXPECT(!publishes<uint64_t>(1ULL << 60, (1ULL << 60) + 1000, UpdateFilter(0, 0.01f)));
+
+    // hysteresis: creeping in small steps stays inside the band
+    {
+        FilteredValueSlot<float> slot(0.0f, UpdateFilter(1.0f));
+        bool any = false;
+        for (int i = 1; i <= 9; ++i) any |= slot.update(i * 0.1f, 0);
+        EXPECT(!any);
+        EXPECT(slot.update(1.5f, 0));
+    }
+
+    // minimum interval: held back, the newest sample goes out afterwards
+    {
+        FilteredValueSlot<int> slot(0, UpdateFilter(0, 0, 1000));
+        EXPECT(slot.update(1, 0));
+        EXPECT(!slot.update(2, 500));
+        EXPECT(!slot.update(3, 900));
+        EXPECT(slot.update(3, 1000));
+        EXPECT(slot.load() == 3);
+    }
+
+    printf("%s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,143 @@
+// Display values written by one thread while another serialises them: every
+// read must be one complete value (DisplayValueSlot). Fails on the first torn
+// or out-of-order read. Also worth running under -fsanitize=thread.
+#include "WebDisplay.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+struct Pair {
+    uint32_t a, b;
+    bool operator==(const Pair& o) const { return a == o.a && b == o.b; }
+};
+
+static const long kStores   = 300000;
+static const long kMinReads = 10000;   // the writer keeps going until the reader got this far
+
+// the writer only starts once the reader runs, or it may be done before
+struct StartGate {
+    std::atomic<bool> open{false};
+    void pass() { open = true; }
+    void wait() const { while (!open) std::this_thread::yield(); }
+};
+
+// every value is one letter repeated; a torn copy mixes letters or lengths
+static bool stringDisplay() {
+    WebDisplay<String> d("s", 1, String("a"));
+    std::atomic<bool> done{false};
+    std::atomic<long> reads{0};
+    StartGate gate;
+    long torn = 0;
+    std::thread writer([&] {
+        gate.wait();
+        for (long i = 0; i < kStores || reads < kMinReads; ++i) {
+            d.update(String(std::string(size_t(1 + i % 97), char('a' + i % 26))));
+        }
+        done = true;
+    });
+    std::thread reader([&] {
+        gate.pass();
+        while (!done) {
+            const String j = d.routeText();   // {"id":"s","value":"xxxx"}
+            const size_t from = j.find("\"value\":\"") + 9, to = j.rfind('"');
+            for (size_t k = from; k < to; ++k) {
+                if (j[k] != j[from]) { ++torn; break; }
+            }
+            ++reads;
+        }
+    });
+    writer.join();
+    reader.join();
+    printf("WebDisplay<String>: %ld reads, %ld torn\n", reads.load(), torn);
+    return torn == 0;
+}
+
+// two words: b must always be ~a, and a never goes backwards
+static bool pairSlot() {
+    DisplayValueSlot<Pair> slot(Pair{0, ~0u});
+    std::atomic<bool> done{false};
+    std::atomic<long> reads{0};
+    StartGate gate;
+    long bad = 0;
+    std::thread writer([&] {
+        gate.wait();
+        for (uint32_t i = 1; i <= (uint32_t)kStores || reads < kMinReads; ++i) slot.store(Pair{i, ~i});
+        done = true;
+    });
+    std::thread reader([&] {
+        uint32_t last = 0;
+        gate.pass();
+        while (!done) {
+            const Pair p = slot.load();
+            if (p.b != ~p.a || p.a < last) ++bad;
+            last = p.a;
+            ++reads;
+        }
+    });
+    writer.join();
+    reader.join();
+    printf("DisplayValueSlot<Pair>: %ld reads, %ld torn or out of order\n", reads.load(), bad);
+    return bad == 0;
+}
+
+// "<name>":[a,b,null,...] -> values, NaN for null
+static std::vector<float> column(const String& json, const char* name) {
+    std::vector<float> out;
+    const int at = json.indexOf(String("\"") + name + "\":[");
+    if (at < 0) return out;
+    const char* p = json.c_str() + at + strlen(name) + 4;
+    while (*p && *p != ']') {
+        if (*p == 'n') { out.push_back(NAN); p += 4; }
+        else           { char* end; out.push_back(strtof(p, &end)); p = end; }
+        if (*p == ',') ++p;
+    }
+    return out;
+}
+
+// samples rise with time, so every bucket sent must be one the writer
+// really closed: min <= avg <= max, and no slot older than the one before.
+// Slots that roll out of the ring during a send are null (from the column
+// being written on); the writer here is fast enough to make that common
+static bool history() {
+    DisplayHistory<8> hist(0, 0);
+    std::atomic<bool> done{false};
+    std::atomic<long> reads{0};
+    StartGate gate;
+    long bad = 0;
+    std::thread writer([&] {
+        gate.wait();
+        for (uint32_t t = 0; t < (uint32_t)kStores * 10 || reads < kMinReads; t += 10) hist.add((float)t, t);
+        done = true;
+    });
+    std::thread reader([&] {
+        gate.pass();
+        while (!done) {
+            String json;
+            StringChunkWriter w(json);
+            hist.writeJson(w, 0, 0);
+            w.flush();
+            const std::vector<float> mn = column(json, "min"), mx = column(json, "max"), avg = column(json, "avg");
+            float last = -1;
+            bool ok = mn.size() == mx.size() && mn.size() == avg.size();
+            for (size_t i = 0; ok && i < mn.size(); ++i) {
+                if (std::isnan(mn[i]) || std::isnan(mx[i]) || std::isnan(avg[i])) continue;
+                if (!(mn[i] <= avg[i] && avg[i] <= mx[i]) || mn[i] < last) ok = false;
+                last = mx[i];
+            }
+            if (!ok) ++bad;
+            ++reads;
+        }
+    });
+    writer.join();
+    reader.join();
+    printf("DisplayHistory: %ld reads, %ld inconsistent\n", reads.load(), bad);
+    return bad == 0;
+}
+
+int main() {
+    const bool ok = stringDisplay() & pairSlot() & history();
+    printf("%s\n", ok ? "ok" : "FAILED");
+    return ok ? 0 : 1;
+}
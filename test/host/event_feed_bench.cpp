@@ -0,0 +1,81 @@
+// Status and log panels for ten minutes of an open page: the "status" and
+// "log" feeds on one /events stream vs status.js polling /status and /log
+// every 5 s, one connection per request. Simulated time, a busy and a quiet
+// log. Counts the response bytes this stack sends; TCP setup of each polling
+// connection and the browser's request headers come on top.
+#include "BasicWebInterface.h"
+#include "WebLog.h"
+#include <chrono>
+#include <cstdio>
+
+static const uint32_t kMinutes = 10;    // DisplayEventStream's default maxConnectionMs
+static const uint32_t kStepMs  = 250;   // serve loop granularity (the default coalesceMs)
+static const uint32_t kPollMs  = 5000;  // status.js, both panels
+
+struct Result {
+    size_t connections = 0, bytes = 0;
+    double hostUs = 0;
+};
+
+template <typename Step>
+static Result run(uint32_t logEveryMs, Step step) {
+    Result r;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t t = kStepMs; t <= kMinutes * 60000; t += kStepMs) {
+        host::setMillis(t);
+        if (t % logEveryMs == 0) webLog.println("pump 2 on, flow " + String(t % 7000) + " l/h");
+        step(t, r);
+    }
+    r.hostUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    return r;
+}
+
+static void print(const char* name, const Result& r) {
+    printf("  %-20s %5zu connections %9zu bytes %8.0f us host\n",
+           name, r.connections, r.bytes, r.hostUs);
+}
+
+static void compare(uint32_t logEveryMs) {
+    host::setMillis(0);
+    webLog.setLogSize(10);
+
+    BasicWebInterface feeds;
+    feeds.enableDisplayEvents();
+    feeds.setupRoutes();
+    WebServer& fs = feeds.getServer();
+    WiFiClient stream;
+    const Result ev = run(logEveryMs, [&](uint32_t, Result& r) {
+        if (!r.connections) {
+            fs.request(HTTP_GET, "/events");
+            stream = fs.client();
+            r.connections = 1;
+        }
+        feeds.displayEvents().loop();
+        r.bytes = stream.conn().sent.size();
+    });
+
+    BasicWebInterface polled;
+    polled.setupRoutes();
+    WebServer& ps = polled.getServer();
+    ps.recordBodies(false);
+    const Result poll = run(logEveryMs, [&](uint32_t t, Result& r) {
+        if (t % kPollMs) return;
+        for (const char* path : { "/status", "/log" }) {
+            r.bytes += ps.request(HTTP_GET, path).wireBytes;
+            ++r.connections;
+        }
+    });
+
+    printf("log line every %u s:\n", logEveryMs / 1000);
+    print("/events feeds", ev);
+    print("polling /status,/log", poll);
+}
+
+int main() {
+    printf("status + log panels, %u min of an open page\n", kMinutes);
+    compare(2000);
+    compare(60000);
+    printf("status goes out every 5 s either way; the log feed sends the new\n"
+           "entries within 1 s and nothing while the log is unchanged\n");
+    return 0;
+}
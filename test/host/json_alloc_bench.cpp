@@ -0,0 +1,73 @@
+// Heap allocations per display answer: routeText() (the String every display
+// route sent before JsonWriter; now a wrapper) vs writeJson() into a
+// ChunkedWriter, plus /status. Builds against older checkouts as well
+// (make SRC=...), which only have the String path.
+#include "alloc_counter.h"
+#include "WebButton.h"
+#include "WebStatus.h"
+#include "WiFiRSSIDisplay.h"
+#include <cstdio>
+#if __has_include("JsonWriter.h")
+#define HAVE_JSON_WRITER 1
+#endif
+
+// allocations made by one call of 'fn' (after a warm-up call)
+template <typename Fn>
+static long long allocs(Fn fn) {
+    fn();
+    AllocCounter::reset();
+    fn();
+    return AllocCounter::count();
+}
+
+static volatile size_t sink = 0;
+
+template <typename D>
+static void measure(const char* name, const D& d) {
+    size_t bytes = 0;
+    const long long viaString = allocs([&] { const String s = d.routeText(); bytes = s.length(); });
+#ifdef HAVE_JSON_WRITER
+    const long long viaWriter = allocs([&] {
+        char buf[CHUNKED_WRITER_BUFFER_SIZE];
+        BufferChunkWriter w(buf, sizeof(buf));
+        d.writeJson(w);
+        sink = w.length();
+    });
+    printf("  %-22s %4zu bytes  routeText() %2lld  writeJson() %2lld\n", name, bytes, viaString, viaWriter);
+#else
+    printf("  %-22s %4zu bytes  routeText() %2lld\n", name, bytes, viaString);
+#endif
+}
+
+int main() {
+    WebDisplay<float>    temp("temp", 2, 21.5f);
+    WebDisplay<String>   state("state", 2, String("heating, valve 2 open"));
+    WebDisplay<bool>     pump("pump", 2, true);
+    WebBarDisplay<float> tank("tank", 5, 1000.0f, "L");
+    WebButton            reset("reset", "Reset", [] { sink = sink + 1; });
+    WiFiWrapper          wifi;
+    WiFiRSSIDisplay      rssi("rssi", wifi);
+    tank.update(734.5f);
+
+    printf("heap allocations per answer\n");
+    measure("WebDisplay<float>", temp);
+    measure("WebDisplay<String>", state);
+    measure("WebDisplay<bool>", pump);
+    measure("WebBarDisplay<float>", tank);
+    measure("WebButton", reset);
+    measure("WiFiRSSIDisplay", rssi);
+
+    const long long statusString = allocs([] { sink = WebStatus::getSystemStatus().length(); });
+#ifdef HAVE_JSON_WRITER
+    const long long statusWriter = allocs([] {
+        char buf[CHUNKED_WRITER_BUFFER_SIZE];
+        BufferChunkWriter w(buf, sizeof(buf));
+        WebStatus::writeSystemStatus(w);
+        sink = w.length();
+    });
+    printf("  %-22s            getSystemStatus() %2lld  writeSystemStatus() %2lld\n", "/status", statusString, statusWriter);
+#else
+    printf("  %-22s            getSystemStatus() %2lld\n", "/status", statusString);
+#endif
+    return 0;
+}
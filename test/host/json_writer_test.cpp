@@ -0,0 +1,119 @@
+// JsonWriter / JsonTraits / CborTraits: escaping, separators, non-finite
+// numbers, and integers and doubles wider than 32 bits in both formats.
+#include "WebDisplay.h"
+#include <cstdio>
+#include <limits>
+
+static int failures = 0;
+
+#define EXPECT_EQ(got, want)                                                            \
+    do {                                                                                \
+        const std::string g_ = (got), w_ = (want);                                      \
+        if (g_ != w_) {                                                                 \
+            printf("FAILED %s:%d  %s\n  got  %s\n  want %s\n", __FILE__, __LINE__, #got, \
+                   g_.c_str(), w_.c_str());                                             \
+            ++failures;                                                                 \
+        }                                                                               \
+    } while (0)
+
+// output of 'fn' written through a JsonWriter of the given format
+template <typename Fn>
+static std::string render(Fn fn, JsonWriter::Format format = JsonWriter::Format::Json) {
+    String out;
+    {
+        StringChunkWriter w(out);
+        JsonWriter j(w, format);
+        fn(j);
+    }
+    return out;
+}
+
+// CBOR as lower-case hex, bytes separated by spaces
+template <typename Fn>
+static std::string cborHex(Fn fn) {
+    const std::string bytes = render(fn, JsonWriter::Format::Cbor);
+    std::string hex;
+    char b[4];
+    for (unsigned char c : bytes) {
+        snprintf(b, sizeof(b), hex.empty() ? "%02x" : " %02x", c);
+        hex += b;
+    }
+    return hex;
+}
+
+template <typename T>
+static std::string json(const T& v) { return render([&](JsonWriter& j) { j.value(v); }); }
+template <typename T>
+static std::string cbor(const T& v) { return cborHex([&](JsonWriter& j) { j.value(v); }); }
+
+int main() {
+    const float  nan = std::numeric_limits<float>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+
+    // escaping: quotes, backslash, the short escapes, other control characters
+    EXPECT_EQ(json("a\"b\\c"), "\"a\\\"b\\\\c\"");
+    EXPECT_EQ(json("l1\nl2\r\t"), "\"l1\\nl2\\r\\t\"");
+    EXPECT_EQ(json("\x01\x1f"), "\"\\u0001\\u001f\"");
+    EXPECT_EQ(json(String("caf\xc3\xa9 </b>")), "\"caf\xc3\xa9 </b>\"");   // UTF-8 and markup pass through
+    EXPECT_EQ(render([](JsonWriter& j) { j.beginObject().member("k\"ey", 1).endObject(); }),
+              "{\"k\\\"ey\":1}");
+
+    // commas: between members and elements, never after an opening bracket
+    EXPECT_EQ(render([](JsonWriter& j) {
+                  j.beginObject().member("a", 1).key("b").beginArray().value(1).value(2);
+                  j.beginObject().key("c").null().endObject().endArray();
+                  j.key("d").beginObject().endObject().key("e").beginArray().endArray().endObject();
+              }),
+              "{\"a\":1,\"b\":[1,2,{\"c\":null}],\"d\":{},\"e\":[]}");
+    EXPECT_EQ(render([](JsonWriter& j) { j.beginArray().raw("{\"x\":1}").value(true).endArray(); }),
+              "[{\"x\":1},true]");
+
+    // non-finite numbers are null, with and without explicit precision
+    EXPECT_EQ(json(nan), "null");
+    EXPECT_EQ(json(inf), "null");
+    EXPECT_EQ(json(-inf), "null");
+    EXPECT_EQ(render([&](JsonWriter& j) { j.value(nan, 3); }), "null");
+    EXPECT_EQ(json(21.5f), "21.50");
+    EXPECT_EQ(render([](JsonWriter& j) { j.value(21.456f, 1); }), "21.5");
+
+    // 64-bit integers keep every digit
+    EXPECT_EQ(json(std::numeric_limits<int64_t>::max()), "9223372036854775807");
+    EXPECT_EQ(json(std::numeric_limits<int64_t>::min()), "-9223372036854775808");
+    EXPECT_EQ(json(std::numeric_limits<uint64_t>::max()), "18446744073709551615");
+    EXPECT_EQ(json((int64_t)5000000000LL), "5000000000");
+    EXPECT_EQ(json((int32_t)-7), "-7");
+    EXPECT_EQ(json((uint16_t)65535), "65535");
+
+    // doubles: values float32 cannot hold are formatted as doubles
+    EXPECT_EQ(json(123456789.12), "123456789.12");
+    EXPECT_EQ(json(0.1), "0.10");
+    EXPECT_EQ(json(-2.5), "-2.50");
+    EXPECT_EQ(json(1e300).substr(0, 7), "1.00000");   // too long for "%.2f": "%.17g"
+
+    // the same values in CBOR: major type 0/1 with an 8-byte argument,
+    // float64 only where float32 would lose bits
+    EXPECT_EQ(cbor(std::numeric_limits<int64_t>::max()), "1b 7f ff ff ff ff ff ff ff");
+    EXPECT_EQ(cbor(std::numeric_limits<int64_t>::min()), "3b 7f ff ff ff ff ff ff ff");
+    EXPECT_EQ(cbor(std::numeric_limits<uint64_t>::max()), "1b ff ff ff ff ff ff ff ff");
+    EXPECT_EQ(cbor((int64_t)5000000000LL), "1b 00 00 00 01 2a 05 f2 00");
+    EXPECT_EQ(cbor((int64_t)-1), "20");
+    EXPECT_EQ(cbor((uint64_t)4294967295u), "1a ff ff ff ff");
+    EXPECT_EQ(cbor(123456789.12), "fb 41 9d 6f 34 54 7a e1 48");
+    EXPECT_EQ(cbor(21.5), "fa 41 ac 00 00");
+
+    // through a display, as /<id> sends it
+    {
+        WebDisplay<int64_t>  i64("i", 1, 0);
+        WebDisplay<uint64_t> u64("u", 1, 0);
+        WebDisplay<double>   dbl("d", 1, 0.0);
+        i64.update(5000000000LL);
+        u64.update(5000000000ULL);
+        dbl.update(123456789.12);
+        EXPECT_EQ(i64.routeText(), "{\"id\":\"i\",\"value\":5000000000}");
+        EXPECT_EQ(u64.routeText(), "{\"id\":\"u\",\"value\":5000000000}");
+        EXPECT_EQ(dbl.routeText(), "{\"id\":\"d\",\"value\":123456789.12}");
+    }
+
+    printf("%s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,118 @@
+// The "log" event of /events: WebLog::getLogEntriesSince() and
+// WebStatus::writeLogTextSince() send only what changed since a version,
+// everything after a reconnect, and the stream's own connects and
+// disconnects do not change the log it serves.
+#include "BasicWebInterface.h"
+#include "WebLog.h"
+#include "WebStatus.h"
+#include <cstdio>
+
+static int failures = 0;
+
+#define EXPECT_EQ(got, want)                                                            \
+    do {                                                                                \
+        const std::string g_ = (got), w_ = (want);                                      \
+        if (g_ != w_) {                                                                 \
+            printf("FAILED %s:%d  %s\n  got  %s\n  want %s\n", __FILE__, __LINE__, #got, \
+                   g_.c_str(), w_.c_str());                                             \
+            ++failures;                                                                 \
+        }                                                                               \
+    } while (0)
+
+static std::string since(uint32_t v) {
+    String out;
+    {
+        StringChunkWriter w(out);
+        WebStatus::writeLogTextSince(w, v);
+    }
+    return out;
+}
+
+// one <li> as writeLogTextSince() writes it (no time provider: time 0)
+static std::string li(uint32_t seq, const char* msg, int first = -1) {
+    std::string s = "<li data-seq=\"" + std::to_string(seq) + "\"";
+    if (first >= 0) s += " data-first=\"" + std::to_string(first) + "\"";
+    return s + ">1970-01-01 00:00:00: " + msg + "</li>\n";
+}
+
+int main() {
+    webLog.setLogSize(3);
+    EXPECT_EQ(since(0), "");
+
+    webLog.println("a");
+    webLog.println("b");
+    EXPECT_EQ(since(0), li(0, "a", 0) + li(1, "b"));
+
+    // a new entry: only that one
+    uint32_t v = webLog.version();
+    webLog.println("c");
+    EXPECT_EQ(since(v), li(2, "c", 0));
+    EXPECT_EQ(since(webLog.version()), "");
+
+    // print() extending the last entry sends it again
+    webLog.print("d");   // new entry, "a" leaves the ring
+    v = webLog.version();
+    webLog.print("e");
+    EXPECT_EQ(since(v), li(3, "de", 1));
+
+    // a reader a whole ring behind gets every entry
+    v = webLog.version();
+    for (const char* m : { "f", "g", "h", "i" }) webLog.println(m);   // "f" still ends "de"
+    EXPECT_EQ(since(v), li(4, "g", 4) + li(5, "h") + li(6, "i"));
+
+    // through /events, with webLog as the global logger as on a device
+    LoggingBase* const logger = gLogger;
+    gLogger = &webLog;
+    host::setMillis(1000);
+    BasicWebInterface web;
+    web.enableDisplayEvents();
+    web.setupRoutes();
+    WebServer& srv = web.getServer();
+
+    const uint32_t before = webLog.version();
+    srv.request(HTTP_GET, "/events");
+    WiFiClient stream = srv.client();
+    web.displayEvents().loop();
+    EXPECT_EQ(std::to_string(webLog.version() - before), "0");   // connecting logs nothing
+
+    auto logEvents = [&stream](size_t from) {
+        const std::string& s = stream.conn().sent;
+        std::string out;
+        for (size_t at = s.find("event: log\n", from); at != std::string::npos;
+             at = s.find("event: log\n", at + 1)) {
+            out += s.substr(at, s.find("\n\n", at) + 2 - at);
+        }
+        return out;
+    };
+    size_t seen = 0;
+    EXPECT_EQ(logEvents(seen), "event: log\ndata: " + li(4, "g", 4) + "data: " + li(5, "h") +
+                               "data: " + li(6, "i") + "data: \n\n");
+
+    seen = stream.conn().sent.size();
+    webLog.println("j");
+    host::setMillis(2000);
+    web.displayEvents().loop();
+    EXPECT_EQ(logEvents(seen), "event: log\ndata: " + li(7, "j", 5) + "data: \n\n");
+
+    seen = stream.conn().sent.size();
+    host::setMillis(3000);
+    web.displayEvents().loop();
+    EXPECT_EQ(logEvents(seen), "");   // unchanged: no event
+
+    // a new connection starts from the whole ring again
+    stream.stop();
+    host::setMillis(4000);
+    web.displayEvents().loop();
+    EXPECT_EQ(std::to_string(web.displayEvents().clients()), "0");
+    EXPECT_EQ(std::to_string(webLog.version() - before - 1), "0");   // only "j"
+    srv.request(HTTP_GET, "/events");
+    stream = srv.client();
+    host::setMillis(5000);
+    web.displayEvents().loop();
+    EXPECT_EQ(logEvents(0), "event: log\ndata: " + li(5, "h", 5) + "data: " + li(6, "i") +
+                            "data: " + li(7, "j") + "data: \n\n");
+    gLogger = logger;
+
+    printf("%s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,52 @@
+// Float / int formatting: NumberFormat vs what the library used before
+// (String(float, decimals) = malloc + dtostrf + String copy, and snprintf).
+#include "NumberFormat.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// the Arduino-ESP32 String(float, decimals) constructor
+static char* dtostrf_(double v, signed char width, unsigned char prec, char* s) {
+    sprintf(s, "%*.*f", width, prec, v);
+    return s;
+}
+static String arduinoString(float v, unsigned prec) {
+    char* buf = (char*)malloc(prec + 42);
+    String r(dtostrf_(v, prec + 2, prec, buf));
+    free(buf);
+    return r;
+}
+
+static std::vector<float> values;   // typical display / setting values
+
+template <typename F>
+static void time(const char* name, F fn) {
+    const int kRounds = 500;
+    volatile size_t sink = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; ++r) {
+        for (float v : values) sink = sink + fn(v);
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count()
+                      / (kRounds * values.size());
+    printf("  %-36s %6.1f ns/number\n", name, ns);
+}
+
+int main() {
+    std::mt19937 rng(1);
+    for (int i = 0; i < 4096; ++i) values.push_back((rng() % 200000) / 100.0f - 1000.0f);
+
+    for (unsigned p : { 1u, 2u, 4u }) {
+        printf("float, %u decimals\n", p);
+        time("String(float, prec) (malloc+dtostrf)", [&](float v) { return arduinoString(v, p).length(); });
+        time("snprintf \"%.*f\"", [&](float v) { char b[32]; return (size_t)snprintf(b, sizeof(b), "%.*f", (int)p, (double)v); });
+        time("NumberFormat::formatFloat", [&](float v) { char b[NumberFormat::kBufSize]; return NumberFormat::formatFloat(b, v, p); });
+        time("NumberFormat::toString", [&](float v) { return (size_t)NumberFormat::toString(v, p).length(); });
+    }
+    printf("int32\n");
+    time("snprintf \"%ld\"", [&](float v) { char b[12]; return (size_t)snprintf(b, sizeof(b), "%ld", (long)(int32_t)v); });
+    time("NumberFormat::formatInt", [&](float v) { char b[12]; return NumberFormat::formatInt(b, (int32_t)v); });
+    return 0;
+}
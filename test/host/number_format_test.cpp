@@ -0,0 +1,62 @@
+// NumberFormat against printf: formatFloat() must give exactly "%.*f".
+#include "NumberFormat.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+static long checked = 0, mismatches = 0;
+
+static void checkFloat(float f, unsigned prec) {
+    char ours[NumberFormat::kBufSize], ref[64];
+    NumberFormat::formatFloat(ours, f, prec);
+    snprintf(ref, sizeof(ref), "%.*f", (int)prec, (double)f);
+    ref[NumberFormat::kBufSize - 1] = 0;
+    ++checked;
+    if (strcmp(ours, ref)) {
+        if (mismatches < 10) printf("MISMATCH %a prec=%u ours=%s printf=%s\n", f, prec, ours, ref);
+        ++mismatches;
+    }
+}
+
+static void checkInt(int32_t v) {
+    char ours[12], ref[16];
+    NumberFormat::formatInt(ours, v);
+    snprintf(ref, sizeof(ref), "%ld", (long)v);
+    ++checked;
+    if (strcmp(ours, ref)) { printf("MISMATCH int ours=%s printf=%s\n", ours, ref); ++mismatches; }
+}
+
+int main() {
+    // random bit patterns: every exponent, NaN and inf included
+    std::mt19937 rng(1);
+    for (long i = 0; i < 2000000; ++i) {
+        const uint32_t bits = rng();
+        float f;
+        memcpy(&f, &bits, sizeof(f));
+        checkFloat(f, (unsigned)(i % 12));
+    }
+    // values typed into settings: decimal steps, binary fractions, thirds
+    for (int i = -100000; i <= 100000; ++i) {
+        for (unsigned p = 0; p <= 11; ++p) {
+            checkFloat(i / 1000.0f, p);
+            checkFloat(i * 0.125f, p);
+            checkFloat(i / 3.0f, p);
+        }
+    }
+    // ties, extremes, signed zero, and precisions past the fast path
+    const float special[] = { 0.0f, -0.0f, 0.5f, 1.5f, 2.5f, -2.5f, 0.125f, 0.375f, 1e-45f,
+                              3.4e38f, -3.4e38f, 9.2e18f, 1.8e19f, NAN, INFINITY, -INFINITY };
+    for (float f : special) {
+        for (unsigned p = 0; p <= 14; ++p) checkFloat(f, p);
+    }
+    for (int32_t v : { 0, 1, -1, 9, 10, -2147483647 - 1, 2147483647, 123456 }) checkInt(v);
+
+    char buf[12];
+    NumberFormat::formatUInt(buf, 4294967295u);
+    ++checked;
+    if (strcmp(buf, "4294967295")) { printf("MISMATCH uint %s\n", buf); ++mismatches; }
+
+    printf("%ld numbers checked, %ld mismatches\n", checked, mismatches);
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,51 @@
+// Request dispatch: one server.on() handler per path (the stock handler
+// list) vs a single RouteTable, by number of routes.
+#include "RouteTable.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+static volatile long hits = 0;
+
+template <typename Pick>
+static double nsPerDispatch(WebServer& srv, const std::vector<String>& paths, size_t count, Pick pick) {
+    const int kRounds = 200;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < kRounds; ++r) {
+        for (size_t k = 0; k < count; ++k) srv.dispatch(HTTP_GET, paths[pick(k)]);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count()
+           / (kRounds * count);
+}
+
+int main() {
+    printf("%7s %14s %14s %14s %16s\n", "routes", "on() first", "on() last", "on() random", "RouteTable random");
+    for (int n : { 10, 20, 40, 80, 160, 320 }) {
+        // a dashboard's mix: /<display id> and /<display id>/history
+        std::vector<String> paths;
+        for (int i = 0; paths.size() < (size_t)n; ++i) {
+            const String id = "/sensor_" + String(i);
+            paths.push_back(id);
+            paths.push_back(id + "/history");
+        }
+        paths.resize(n);
+
+        WebServer stock;
+        for (auto& p : paths) stock.on(p, HTTP_GET, [] { hits = hits + 1; });
+        WebServer tabled;
+        RouteTable* table = new RouteTable([](const RouteTable::Route&) { hits = hits + 1; });
+        for (auto& p : paths) table->add(p, HTTP_GET, 0);
+        tabled.addHandler(table);
+
+        std::mt19937 rng(n);
+        std::vector<int> order(4096);
+        for (auto& o : order) o = (int)(rng() % n);
+
+        printf("%7d %11.1f ns %11.1f ns %11.1f ns %13.1f ns\n", n,
+               nsPerDispatch(stock,  paths, order.size(), [&](size_t) { return 0; }),
+               nsPerDispatch(stock,  paths, order.size(), [&](size_t) { return n - 1; }),
+               nsPerDispatch(stock,  paths, order.size(), [&](size_t k) { return order[k]; }),
+               nsPerDispatch(tabled, paths, order.size(), [&](size_t k) { return order[k]; }));
+    }
+    return 0;
+}
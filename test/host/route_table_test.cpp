@@ -0,0 +1,53 @@
+// RouteTable: every route is found with its kind and target, a later add()
+// replaces, other methods and unknown paths miss and fall through.
+#include "RouteTable.h"
+#include <cstdio>
+
+static int failures = 0;
+
+#define EXPECT(cond)                                                   \
+    do {                                                               \
+        if (!(cond)) { printf("FAILED %s:%d  %s\n", __FILE__, __LINE__, #cond); ++failures; } \
+    } while (0)
+
+static String path(int i) { return "/d" + String(i); }
+
+int main() {
+    RouteTable t([](const RouteTable::Route&) {});
+    for (int i = 0; i < 500; ++i) {
+        t.add(path(i), HTTP_GET, i % 7, (void*)(intptr_t)i);
+        t.add(path(i), HTTP_POST, 9);
+    }
+    t.add("/d3", HTTP_GET, 42);   // replaces
+    EXPECT(t.size() == 1000);
+
+    int wrong = 0;
+    for (int i = 0; i < 500; ++i) {
+        const RouteTable::Route* r = t.find(HTTP_GET, path(i));
+        if (!r) { ++wrong; continue; }
+        if (i == 3) { if (r->kind != 42) ++wrong; continue; }
+        if (r->kind != i % 7 || r->target != (void*)(intptr_t)i) ++wrong;
+        const RouteTable::Route* p = t.find(HTTP_POST, path(i));
+        if (!p || p->kind != 9) ++wrong;
+    }
+    EXPECT(wrong == 0);
+    EXPECT(!t.find(HTTP_GET, "/d500"));
+    EXPECT(!t.find(HTTP_GET, "/"));
+    EXPECT(!t.find(HTTP_PUT, "/d1"));
+
+    // through the server: the table first, unknown paths reach later handlers
+    WebServer srv;
+    int kind = -1, fallback = 0;
+    RouteTable* routes = new RouteTable([&](const RouteTable::Route& r) { kind = r.kind; });
+    routes->add("/a", HTTP_GET, 1);
+    routes->add("/b", HTTP_POST, 2);
+    srv.addHandler(routes);
+    srv.on("/c", HTTP_GET, [&] { ++fallback; });
+    EXPECT(srv.dispatch(HTTP_GET, "/a") && kind == 1);
+    EXPECT(srv.dispatch(HTTP_POST, "/b") && kind == 2);
+    EXPECT(!srv.dispatch(HTTP_POST, "/a"));
+    EXPECT(srv.dispatch(HTTP_GET, "/c") && fallback == 1);
+
+    printf("%s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
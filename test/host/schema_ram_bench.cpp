@@ -0,0 +1,58 @@
+// RAM of 100 settings: DEF_SETTING members vs a SchemaSettingsBlock. Object
+// size plus the heap the block allocates while it is built and loaded.
+#include "alloc_counter.h"
+#include "WebSettingsSchema.h"
+#include <cstdio>
+
+#define TEN_(M, p) M(p##0) M(p##1) M(p##2) M(p##3) M(p##4) M(p##5) M(p##6) M(p##7) M(p##8) M(p##9)
+
+// 50 float, 30 int, 20 bool
+#define DEF_FLOAT_(n) DEF_SETTING(float,   n, "Setpoint " #n, 21.5f, 0.1f);
+#define DEF_INT_(n)   DEF_SETTING(int32_t, n, "Counter " #n,  1200,  1);
+#define DEF_BOOL_(n)  DEF_SETTING(bool,    n, "Enable " #n,   true,  1);
+
+struct MemberBlock : public SettingsBlockBase {
+    MemberBlock() : SettingsBlockBase("members", "/members") {}
+    TEN_(DEF_FLOAT_, f1) TEN_(DEF_FLOAT_, f2) TEN_(DEF_FLOAT_, f3) TEN_(DEF_FLOAT_, f4) TEN_(DEF_FLOAT_, f5)
+    TEN_(DEF_INT_, i1)   TEN_(DEF_INT_, i2)   TEN_(DEF_INT_, i3)
+    TEN_(DEF_BOOL_, b1)  TEN_(DEF_BOOL_, b2)
+};
+
+#define FIELD_FLOAT_(n) float   n;
+#define FIELD_INT_(n)   int32_t n;
+#define FIELD_BOOL_(n)  bool    n;
+struct Values {
+    TEN_(FIELD_FLOAT_, f1) TEN_(FIELD_FLOAT_, f2) TEN_(FIELD_FLOAT_, f3) TEN_(FIELD_FLOAT_, f4) TEN_(FIELD_FLOAT_, f5)
+    TEN_(FIELD_INT_, i1)   TEN_(FIELD_INT_, i2)   TEN_(FIELD_INT_, i3)
+    TEN_(FIELD_BOOL_, b1)  TEN_(FIELD_BOOL_, b2)
+};
+
+#define SCHEMA_FLOAT_(n) SCHEMA_FLOAT(Values, n, "Setpoint " #n, 21.5f, 0.1f),
+#define SCHEMA_INT_(n)   SCHEMA_INT  (Values, n, "Counter " #n,  1200),
+#define SCHEMA_BOOL_(n)  SCHEMA_BOOL (Values, n, "Enable " #n,   true),
+constexpr SettingSchema kSchema[] = {
+    TEN_(SCHEMA_FLOAT_, f1) TEN_(SCHEMA_FLOAT_, f2) TEN_(SCHEMA_FLOAT_, f3) TEN_(SCHEMA_FLOAT_, f4) TEN_(SCHEMA_FLOAT_, f5)
+    TEN_(SCHEMA_INT_, i1)   TEN_(SCHEMA_INT_, i2)   TEN_(SCHEMA_INT_, i3)
+    TEN_(SCHEMA_BOOL_, b1)  TEN_(SCHEMA_BOOL_, b2)
+};
+static_assert(sizeof(kSchema) / sizeof(kSchema[0]) == 100, "100 settings");
+
+template <typename Block, typename Make>
+static void measure(const char* name, Make make) {
+    const long long before = AllocCounter::live();
+    AllocCounter::reset();
+    Block* b = make();
+    b->begin();
+    const long long heap = AllocCounter::live() - before - (long long)sizeof(Block);
+    printf("%-12s object %6zu bytes + heap %6lld bytes = %6lld bytes RAM (%lld allocations)\n",
+           name, sizeof(Block), heap, (long long)sizeof(Block) + heap, AllocCounter::count());
+    delete b;
+}
+
+int main() {
+    printf("100 settings (50 float, 30 int, 20 bool), %zu-bit pointers\n", sizeof(void*) * 8);
+    measure<MemberBlock>("DEF_SETTING", [] { return new MemberBlock(); });
+    measure<SchemaSettingsBlock<Values>>("schema", [] { return new SchemaSettingsBlock<Values>("schema", "/schema", kSchema); });
+    printf("schema table %zu bytes in flash (.rodata)\n", sizeof(kSchema));
+    return 0;
+}
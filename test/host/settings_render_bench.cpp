@@ -0,0 +1,53 @@
+// Settings form: peak heap and time of one GET <url>, served through the
+// block's own route. Builds against older checkouts as well (make SRC=...),
+// where the route sent generateHTML() as one String.
+#include "alloc_counter.h"
+#include "WebSettings.h"
+#include <chrono>
+#include <cstdio>
+
+#define TEN_(M, p) M(p##0) M(p##1) M(p##2) M(p##3) M(p##4) M(p##5) M(p##6) M(p##7) M(p##8) M(p##9)
+#define FLOAT_(n)  DEF_SETTING(float,   n, "Setpoint " #n, 21.5f, 0.1f);
+#define INT_(n)    DEF_SETTING(int32_t, n, "Counter " #n,  1200,  1);
+#define BOOL_(n)   DEF_SETTING(bool,    n, "Enable " #n,   true,  1);
+#define ARRAY_(n)  DEF_SETTING_ARRAY(float, n, "Curve " #n, 0.25f, 0.01f, 16);
+
+// 62 settings and four 16-element arrays, the size of a larger device
+struct BigBlock : public SettingsBlockBase {
+    BigBlock() : SettingsBlockBase("render", "/cfg") {}
+    TEN_(FLOAT_, f1) TEN_(FLOAT_, f2) TEN_(FLOAT_, f3)
+    TEN_(INT_, i1)   TEN_(INT_, i2)
+    TEN_(BOOL_, b1)
+    Setting<String> host{*this, "host", "Host name", String("pump-controller")};
+    Setting<String> topic{*this, "topic", "MQTT topic", String("plant/pumps/<1>")};
+    ARRAY_(c0) ARRAY_(c1) ARRAY_(c2) ARRAY_(c3)
+};
+
+int main() {
+    WebServer srv;
+    BigBlock block;
+    block.begin();
+    block.setupRoutes(srv);
+
+    const size_t bodyLen = srv.request(HTTP_GET, "/cfg").body.size();
+    srv.recordBodies(false);   // measure the render, not the recording
+
+    AllocCounter::reset();
+    const long long idle = AllocCounter::live();
+    const WebServer::Response& r = srv.request(HTTP_GET, "/cfg");
+    const long long peak = AllocCounter::peak() - idle;
+    const long long allocs = AllocCounter::count();
+
+    const int kRounds = 2000;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRounds; ++i) srv.request(HTTP_GET, "/cfg");
+    const double us = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - t0).count() / kRounds;
+
+    printf("settings form, %zu bytes, status %d, %s\n", bodyLen, r.code,
+           r.header("Transfer-Encoding").length() ? "chunked" : "one piece");
+    printf("  peak heap during the request  %7lld bytes\n", peak);
+    printf("  allocations per request       %7lld\n", allocs);
+    printf("  time per request (host)       %7.1f us\n", us);
+    return 0;
+}
@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------
+// Arduino.h  – host stand-in for the parts of the ESP32 Arduino core the
+// library uses: String, flash-string helpers, millis(), IPAddress, Serial and
+// (like the real core) the FreeRTOS API from freertos_host.h
+// -----------------------------------------------------------------------------
+#pragma once
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+using std::isnan;
+using std::isinf;
+
+struct __FlashStringHelper;
+#define F(s)               (reinterpret_cast<const __FlashStringHelper*>(s))
+#define PROGMEM
+#define PGM_P              const char*
+#define pgm_read_byte(p)   (*(const uint8_t*)(p))
+#define memcpy_P           memcpy
+#define strlen_P           strlen
+#define FPSTR(p)           (reinterpret_cast<const __FlashStringHelper*>(p))
+
+class String : public std::string {
+public:
+    String() {}
+    String(const char* s) : std::string(s ? s : "") {}
+    String(const std::string& s) : std::string(s) {}
+    String(const __FlashStringHelper* s) : std::string(reinterpret_cast<const char*>(s)) {}
+    explicit String(char c) : std::string(1, c) {}
+    String(int v) : std::string(std::to_string(v)) {}
+    String(unsigned v) : std::string(std::to_string(v)) {}
+    String(long v) : std::string(std::to_string(v)) {}
+    String(unsigned long v) : std::string(std::to_string(v)) {}
+    String(long long v) : std::string(std::to_string(v)) {}
+    String(unsigned long long v) : std::string(std::to_string(v)) {}
+    String(float v, unsigned d = 2)  { fromDouble_(v, d); }
+    String(double v, unsigned d = 2) { fromDouble_(v, d); }
+
+    unsigned length() const     { return (unsigned)size(); }
+    const char* c_str() const   { return std::string::c_str(); }
+    bool reserve(unsigned n)    { std::string::reserve(n); return true; }
+    bool concat(const char* d, unsigned n) { append(d, n); return true; }
+    bool concat(const String& s) { append(s); return true; }
+    char charAt(unsigned i) const { return i < size() ? (*this)[i] : 0; }
+
+    long   toInt() const   { return strtol(c_str(), nullptr, 10); }
+    float  toFloat() const { return strtof(c_str(), nullptr); }
+    double toDouble() const { return strtod(c_str(), nullptr); }
+
+    int indexOf(char c, unsigned from = 0) const        { return pos_(find(c, from)); }
+    int indexOf(const char* s, unsigned from = 0) const { return pos_(find(s, from)); }
+    int indexOf(const String& s, unsigned from = 0) const { return pos_(find(s, from)); }
+    int lastIndexOf(char c) const                       { return pos_(rfind(c)); }
+    bool startsWith(const String& s) const { return compare(0, s.size(), s) == 0; }
+    bool endsWith(const String& s) const {
+        return size() >= s.size() && compare(size() - s.size(), s.size(), s) == 0;
+    }
+    bool equals(const String& s) const { return *this == s; }
+    String substring(unsigned from) const { return from < size() ? String(substr(from)) : String(); }
+    String substring(unsigned from, unsigned to) const {
+        return from < to && from < size() ? String(substr(from, to - from)) : String();
+    }
+    void trim() {
+        const size_t b = find_first_not_of(" \t\r\n");
+        if (b == npos) { clear(); return; }
+        assign(substr(b, find_last_not_of(" \t\r\n") - b + 1));
+    }
+    void replace(const String& from, const String& to) {
+        if (from.empty()) return;
+        for (size_t at = find(from); at != npos; at = find(from, at + to.size())) {
+            std::string::replace(at, from.size(), to);
+        }
+    }
+    void toLowerCase() { for (auto& c : *this) c = (char)tolower((unsigned char)c); }
+
+    String& operator+=(const String& s)  { append(s); return *this; }
+    String& operator+=(const char* s)    { if (s) append(s); return *this; }
+    String& operator+=(const __FlashStringHelper* s) { append(reinterpret_cast<const char*>(s)); return *this; }
+    String& operator+=(char c)           { push_back(c); return *this; }
+    String& operator+=(int v)            { append(std::to_string(v)); return *this; }
+    String& operator+=(unsigned v)       { append(std::to_string(v)); return *this; }
+
+private:
+    static int pos_(size_t p) { return p == npos ? -1 : (int)p; }
+    void fromDouble_(double v, unsigned d) { char b[64]; snprintf(b, sizeof(b), "%.*f", (int)d, v); assign(b); }
+};
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const char* b)   { String r(a); r += b; return r; }
+inline String operator+(const char* a, const String& b)   { String r(a); r += b; return r; }
+inline String operator+(const String& a, char b)          { String r(a); r += b; return r; }
+inline String operator+(char a, const String& b)          { String r(a); r += b; return r; }
+inline String operator+(const String& a, const __FlashStringHelper* b) { String r(a); r += b; return r; }
+
+// -----------------------------------------------------------------------------
+//  Time: the real clock, unless a test pins it with host::setMillis()
+// -----------------------------------------------------------------------------
+namespace host {
+    inline std::atomic<int64_t>& pinnedMillis_() { static std::atomic<int64_t> v{-1}; return v; }
+    inline void setMillis(uint32_t ms) { pinnedMillis_() = ms; }
+    inline void releaseMillis()        { pinnedMillis_() = -1; }
+}
+inline uint32_t millis() {
+    const int64_t pinned = host::pinnedMillis_().load();
+    if (pinned >= 0) return (uint32_t)pinned;
+    static const auto start = std::chrono::steady_clock::now();
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+inline void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline float temperatureRead() { return 47.5f; }
+
+// -----------------------------------------------------------------------------
+//  IPAddress, Serial
+// -----------------------------------------------------------------------------
+class IPAddress {
+public:
+    IPAddress() : b_{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : b_{a, b, c, d} {}
+    uint8_t operator[](int i) const { return b_[i]; }
+    uint8_t& operator[](int i)      { return b_[i]; }
+    bool operator==(const IPAddress& o) const { return memcmp(b_, o.b_, 4) == 0; }
+private:
+    uint8_t b_[4];
+};
+
+struct HostSerial {
+    void begin(unsigned long) {}
+    void print(const String&) {}
+    void println(const String& = String()) {}
+};
+extern HostSerial Serial;
+
+#include "freertos_host.h"
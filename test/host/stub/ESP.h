@@ -0,0 +1,10 @@
+// ESP.h  – host stand-in for the heap figures of EspClass
+#pragma once
+#include <cstdint>
+
+struct HostEsp {
+    uint32_t getFreeHeap()     const { return 180u * 1024; }
+    uint32_t getMaxAllocHeap() const { return 110u * 1024; }
+    uint32_t getHeapSize()     const { return 300u * 1024; }
+};
+extern HostEsp ESP;
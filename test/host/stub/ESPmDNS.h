@@ -0,0 +1,8 @@
+// ESPmDNS.h  – host stand-in
+#pragma once
+#include <Arduino.h>
+
+struct HostMDNS {
+    bool begin(const String&) { return true; }
+};
+extern HostMDNS MDNS;
@@ -0,0 +1,12 @@
+// LoggingBase.h  – host stand-in for the logger interface (gLogger)
+#pragma once
+#include <Arduino.h>
+
+class LoggingBase {
+public:
+    virtual ~LoggingBase() {}
+    virtual void begin() {}
+    virtual void print(const String&) {}
+    virtual void println(const String&) {}
+};
+extern LoggingBase* gLogger;   // host_runtime.cpp: a logger that drops everything
@@ -0,0 +1,16 @@
+// MACAddress.h  – host stand-in for tcpmsg::MACAddress
+#pragma once
+#include <cstdint>
+#include <cstring>
+
+namespace tcpmsg {
+class MACAddress {
+public:
+    MACAddress() { memset(b_, 0, 6); }
+    const uint8_t* bytes() const        { return b_; }
+    void setBytes(const uint8_t* b)     { memcpy(b_, b, 6); }
+    bool operator==(const MACAddress& o) const { return memcmp(b_, o.b_, 6) == 0; }
+private:
+    uint8_t b_[6];
+};
+}
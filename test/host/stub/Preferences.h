@@ -0,0 +1,100 @@
+// -----------------------------------------------------------------------------
+// Preferences.h  – host stand-in for the ESP32 NVS wrapper
+//
+// Values live in a process-wide map per namespace (so a second Preferences on
+// the same namespace sees them, like NVS). Every call is counted, and
+// entries() estimates the 32-byte NVS entries the data would occupy:
+// one per scalar, 1 + ceil(len / 32) per string, and for blobs one index
+// entry plus a data entry and ceil(len / 32) payload entries.
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+#include <map>
+#include <vector>
+
+class Preferences {
+public:
+    struct Stats {
+        size_t lookups = 0;   // get*/isKey/getBytesLength calls
+        size_t writes  = 0;   // put*/remove calls
+    };
+    static Stats& stats() { static Stats s; return s; }
+
+    bool begin(const char* ns, bool readOnly = false) { (void)readOnly; ns_ = ns; return true; }
+    void end() {}
+    bool clear() { store_()[ns_].clear(); return true; }
+    bool remove(const char* key) { ++stats().writes; return store_()[ns_].erase(key) > 0; }
+    bool isKey(const char* key) { ++stats().lookups; return find_(key) != nullptr; }
+
+    size_t putInt(const char* k, int32_t v)    { return put_(k, kInt_, &v, sizeof(v)); }
+    size_t putUInt(const char* k, uint32_t v)  { return put_(k, kInt_, &v, sizeof(v)); }
+    size_t putFloat(const char* k, float v)    { return put_(k, kBlob_, &v, sizeof(v)); }   // NVS stores floats as blobs
+    size_t putBool(const char* k, bool v)      { const uint8_t b = v; return put_(k, kInt_, &b, 1); }
+    size_t putString(const char* k, const String& v) { return put_(k, kStr_, v.c_str(), v.length() + 1); }
+    size_t putBytes(const char* k, const void* v, size_t n) { return put_(k, kBlob_, v, n); }
+
+    int32_t  getInt(const char* k, int32_t def = 0)   { return get_(k, def); }
+    uint32_t getUInt(const char* k, uint32_t def = 0) { return get_(k, def); }
+    float    getFloat(const char* k, float def = 0)   { return get_(k, def); }
+    bool     getBool(const char* k, bool def = false) {
+        const Value* v = lookup_(k);
+        return v ? v->data[0] != 0 : def;
+    }
+    String getString(const char* k, const String& def = String()) {
+        const Value* v = lookup_(k);
+        return v ? String(reinterpret_cast<const char*>(v->data.data())) : def;
+    }
+    size_t getBytesLength(const char* k) {
+        const Value* v = lookup_(k);
+        return v ? v->data.size() : 0;
+    }
+    size_t getBytes(const char* k, void* buf, size_t maxLen) {
+        const Value* v = lookup_(k);
+        if (!v || v->data.size() > maxLen) return 0;
+        memcpy(buf, v->data.data(), v->data.size());
+        return v->data.size();
+    }
+
+    /** estimated NVS entries used by namespace 'ns' */
+    static size_t entries(const char* ns) {
+        size_t n = 0;
+        for (auto& kv : store_()[ns]) {
+            const size_t len = kv.second.data.size();
+            if      (kv.second.kind == kInt_) n += 1;
+            else if (kv.second.kind == kStr_) n += 1 + (len + 31) / 32;
+            else                              n += 2 + (len + 31) / 32;
+        }
+        return n;
+    }
+    static size_t keys(const char* ns) { return store_()[ns].size(); }
+    static void   reset() { store_().clear(); stats() = Stats(); }
+
+private:
+    enum Kind_ : uint8_t { kInt_, kStr_, kBlob_ };
+    struct Value { Kind_ kind; std::vector<uint8_t> data; };
+    typedef std::map<std::string, std::map<std::string, Value>> Store;
+    static Store& store_() { static Store s; return s; }
+
+    const Value* find_(const char* k) {
+        auto& m  = store_()[ns_];
+        auto  it = m.find(k);
+        return it == m.end() ? nullptr : &it->second;
+    }
+    const Value* lookup_(const char* k) { ++stats().lookups; return find_(k); }
+    size_t put_(const char* k, Kind_ kind, const void* v, size_t n) {
+        ++stats().writes;
+        const uint8_t* p = static_cast<const uint8_t*>(v);
+        store_()[ns_][k] = Value{kind, std::vector<uint8_t>(p, p + n)};
+        return n;
+    }
+    template <typename T>
+    T get_(const char* k, T def) {
+        const Value* v = lookup_(k);
+        if (!v || v->data.size() != sizeof(T)) return def;
+        T out;
+        memcpy(&out, v->data.data(), sizeof(T));
+        return out;
+    }
+
+    std::string ns_;
+};
@@ -0,0 +1,13 @@
+// TimeManager.h  – host stand-in
+#pragma once
+#include <Arduino.h>
+#include <ctime>
+
+struct TimeManager {
+    static String formattedDateAndTime(uint32_t unixTime) {
+        const time_t t = (time_t)unixTime;
+        char buf[24];
+        strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", gmtime(&t));
+        return String(buf);
+    }
+};
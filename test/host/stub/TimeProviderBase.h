@@ -0,0 +1,10 @@
+// TimeProviderBase.h  – host stand-in
+#pragma once
+#include <Arduino.h>
+
+class TimeProviderBase {
+public:
+    virtual ~TimeProviderBase() {}
+    virtual uint32_t getUnixTime() = 0;
+};
+extern TimeProviderBase* gTimeProvider;
@@ -0,0 +1,242 @@
+// -----------------------------------------------------------------------------
+// WebServer.h  – host stand-in for the arduino-esp32 2.x synchronous WebServer
+//
+// Handlers are matched the way the real server does it (a linked list of
+// RequestHandlers, canHandle() then handle()). Responses are not sent
+// anywhere: request() runs one request and returns what the handler sent,
+// with the header block the real _prepareHeader() would have produced.
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+#include <functional>
+#include <vector>
+#include <utility>
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+class WebServer;
+
+// shape of detail/RequestHandler.h (URI by value, as before core 3.0)
+class RequestHandler {
+public:
+    virtual ~RequestHandler() {}
+    virtual bool canHandle(HTTPMethod, String) { return false; }
+    virtual bool handle(WebServer&, HTTPMethod, String) { return false; }
+    RequestHandler* next()              { return next_; }
+    void            next(RequestHandler* r) { next_ = r; }
+private:
+    RequestHandler* next_ = nullptr;
+};
+
+// server.on(): FunctionRequestHandler + Uri::canHandle (exact match)
+class FunctionRequestHandler : public RequestHandler {
+public:
+    FunctionRequestHandler(std::function<void()> fn, const String& uri, HTTPMethod method)
+        : fn_(std::move(fn)), uri_(uri), method_(method) {}
+    bool canHandle(HTTPMethod m, String uri) override {
+        return (method_ == HTTP_ANY || method_ == m) && uri == uri_;
+    }
+    bool handle(WebServer&, HTTPMethod m, String uri) override {
+        if (!canHandle(m, uri)) return false;
+        fn_();
+        return true;
+    }
+private:
+    std::function<void()> fn_;
+    String                uri_;
+    HTTPMethod            method_;
+};
+
+struct HTTPUpload {
+    int    status = 0;
+    String filename;
+    size_t totalSize = 0, currentSize = 0;
+    uint8_t buf[1436];
+};
+
+class WebServer {
+public:
+    typedef std::vector<std::pair<String, String>> Fields;
+
+    /** what one request produced */
+    struct Response {
+        int         code      = 0;
+        String      head;          // status line + headers, as the real server writes them
+        std::string body;          // de-chunked body
+        size_t      wireBytes = 0; // head + body + chunk framing
+        String header(const char* name) const {
+            const String key = String("\r\n") + name + ": ";
+            const int at = head.indexOf(key);
+            if (at < 0) return String();
+            const int from = at + (int)key.length();
+            return head.substring(from, head.indexOf("\r\n", from));
+        }
+    };
+
+    explicit WebServer(int port = 80) { (void)port; }
+    ~WebServer() {
+        for (RequestHandler* h = first_; h;) { RequestHandler* n = h->next(); delete h; h = n; }
+    }
+
+    void begin() {}
+    void handleClient() {}
+
+    // ---- routing ---------------------------------------------------------
+    void on(const String& uri, HTTPMethod m, std::function<void()> fn) {
+        addHandler(new FunctionRequestHandler(std::move(fn), uri, m));
+    }
+    void on(const String& uri, std::function<void()> fn) { on(uri, HTTP_ANY, std::move(fn)); }
+    void addHandler(RequestHandler* h) {
+        if (!last_) first_ = h; else last_->next(h);
+        last_ = h;
+    }
+    void onNotFound(std::function<void()> fn) { notFound_ = std::move(fn); }
+    void collectHeaders(const char**, size_t) {}
+
+    // ---- current request -------------------------------------------------
+    String     uri() const     { return uri_; }
+    HTTPMethod method() const  { return method_; }
+    int        args() const    { return (int)args_.size(); }
+    String     argName(int i) const { return i < args() ? args_[i].first : String(); }
+    String     arg(int i) const     { return i < args() ? args_[i].second : String(); }
+    String     arg(const String& name) const {
+        for (auto& a : args_) if (a.first == name) return a.second;
+        return String();
+    }
+    bool   hasArg(const String& name) const {
+        for (auto& a : args_) if (a.first == name) return true;
+        return false;
+    }
+    String header(const String& name) const {
+        for (auto& h : headers_) if (h.first == name) return h.second;
+        return String();
+    }
+    WiFiClient  client()  { return client_; }
+    HTTPUpload& upload()  { return upload_; }
+
+    // ---- response --------------------------------------------------------
+    void sendHeader(const String& name, const String& value, bool first = false) {
+        const String line = name + ": " + value + "\r\n";
+        if (first) extraHeaders_ = line + extraHeaders_;
+        else       extraHeaders_ += line;
+    }
+    void setContentLength(size_t len) { contentLength_ = len; }
+
+    void send(int code, const char* contentType = nullptr, const String& content = String()) {
+        prepareHeader_(code, contentType, content.length());
+        if (content.length()) sendContent(content);
+    }
+    void send(int code, const String& contentType, const String& content) {
+        send(code, contentType.c_str(), content);
+    }
+    void send_P(int code, PGM_P contentType, PGM_P content, size_t len) {
+        prepareHeader_(code, contentType, len);
+        sendContent(content, len);
+    }
+    void sendContent(const String& s) { sendContent(s.c_str(), s.length()); }
+    void sendContent(const char* data, size_t n) {
+        if (chunked_) {
+            char hex[12];
+            const int h = snprintf(hex, sizeof(hex), "%zx\r\n", n);
+            res_.wireBytes += (size_t)h + 2;
+        }
+        if (recordBody_) res_.body.append(data, n);
+        res_.wireBytes += n;
+        if (chunked_ && n == 0) chunked_ = false;
+    }
+
+    // ---- host side -------------------------------------------------------
+    /** runs one request ("/path?a=1&b=2") through the handler list */
+    const Response& request(HTTPMethod m, const String& target,
+                            const Fields& headers = Fields(), const String& body = String()) {
+        res_ = Response();
+        extraHeaders_ = String();
+        contentLength_ = CONTENT_LENGTH_NOT_SET;
+        chunked_ = false;
+        method_  = m;
+        headers_ = headers;
+        client_  = WiFiClient();
+        args_.clear();
+        const int q = target.indexOf('?');
+        uri_ = q < 0 ? target : target.substring(0, q);
+        if (q >= 0) parseQuery_(target.substring(q + 1));
+        if (body.length()) args_.emplace_back("plain", body);
+
+        if (!dispatch(m, uri_) && notFound_) notFound_();
+        return res_;
+    }
+    /** just the handler walk of a request (what _handleRequest() does) */
+    bool dispatch(HTTPMethod m, const String& uri) {
+        for (RequestHandler* h = first_; h; h = h->next()) {
+            if (h->canHandle(m, uri) && h->handle(*this, m, uri)) return true;
+        }
+        return false;
+    }
+    const Response& response() const { return res_; }
+    /** off: bodies are only counted (keeps the recording out of heap measurements) */
+    void recordBodies(bool on)       { recordBody_ = on; }
+    RequestHandler* firstHandler()   { return first_; }
+
+private:
+    void prepareHeader_(int code, const char* contentType, size_t len) {
+        String h = "HTTP/1.1 " + String(code) + " " + reason_(code) + "\r\n";
+        h += "Content-Type: "; h += contentType ? contentType : "text/html"; h += "\r\n";
+        if (contentLength_ == CONTENT_LENGTH_NOT_SET) {
+            h += "Content-Length: " + String((unsigned long)len) + "\r\n";
+        } else if (contentLength_ != CONTENT_LENGTH_UNKNOWN) {
+            h += "Content-Length: " + String((unsigned long)contentLength_) + "\r\n";
+        } else {
+            chunked_ = true;
+            h += "Accept-Ranges: none\r\nTransfer-Encoding: chunked\r\n";
+        }
+        h += "Connection: close\r\n";
+        h += extraHeaders_;
+        h += "\r\n";
+        extraHeaders_ = String();
+        contentLength_ = CONTENT_LENGTH_NOT_SET;
+        res_.code = code;
+        res_.head = h;
+        res_.wireBytes += h.length();
+    }
+    static const char* reason_(int code) {
+        switch (code) {
+            case 200: return "OK";          case 303: return "See Other";
+            case 302: return "Found";       case 304: return "Not Modified";
+            case 400: return "Bad Request"; case 401: return "Unauthorized";
+            case 404: return "Not Found";   case 503: return "Service Unavailable";
+            default:  return "";
+        }
+    }
+    void parseQuery_(const String& q) {
+        size_t at = 0;
+        while (at <= q.length()) {
+            size_t amp = q.find('&', at);
+            if (amp == std::string::npos) amp = q.length();
+            const String kv = q.substring((unsigned)at, (unsigned)amp);
+            const int eq = kv.indexOf('=');
+            if (kv.length()) args_.emplace_back(eq < 0 ? kv : kv.substring(0, eq),
+                                                eq < 0 ? String() : kv.substring(eq + 1));
+            at = amp + 1;
+        }
+    }
+
+    RequestHandler*       first_ = nullptr;
+    RequestHandler*       last_  = nullptr;
+    std::function<void()> notFound_;
+
+    String     uri_;
+    HTTPMethod method_ = HTTP_GET;
+    Fields     args_, headers_;
+    WiFiClient client_;
+    HTTPUpload upload_;
+
+    Response res_;
+    String   extraHeaders_;
+    size_t   contentLength_ = CONTENT_LENGTH_NOT_SET;
+    bool     chunked_       = false;
+    bool     recordBody_    = true;
+};
@@ -0,0 +1,43 @@
+// -----------------------------------------------------------------------------
+// WiFi.h  – host stand-in: a WiFiClient that records what is written to it
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+#include <memory>
+
+/* Copies share one connection, like the real (reference-counted) client. */
+class WiFiClient {
+public:
+    struct Conn {
+        std::string sent;            // everything written so far
+        size_t      writes    = 0;   // write() calls
+        bool        open      = true;
+        size_t      failAfter = (size_t)-1;   // simulated peer loss: short write past this many bytes
+    };
+
+    WiFiClient() : c_(std::make_shared<Conn>()) {}
+
+    size_t write(const uint8_t* buf, size_t n) {
+        if (!c_->open) return 0;
+        ++c_->writes;
+        if (c_->sent.size() + n > c_->failAfter) { c_->open = false; return 0; }
+        c_->sent.append(reinterpret_cast<const char*>(buf), n);
+        return n;
+    }
+    size_t write(const char* s) { return write(reinterpret_cast<const uint8_t*>(s), strlen(s)); }
+    uint8_t connected()         { return c_->open; }
+    void    stop()              { c_->open = false; }
+    void    setNoDelay(bool)    {}
+    explicit operator bool() const { return c_->open; }
+
+    Conn& conn() { return *c_; }
+
+private:
+    std::shared_ptr<Conn> c_;
+};
+
+struct HostWiFi {
+    int32_t RSSI() const { return -62; }
+    String  SSID() const { return "hostnet"; }
+};
+extern HostWiFi WiFi;
@@ -0,0 +1,11 @@
+// -----------------------------------------------------------------------------
+// WiFiWrapper.h  – host stand-in for the connection manager WiFiRSSIDisplay reads
+// -----------------------------------------------------------------------------
+#pragma once
+#include <Arduino.h>
+
+class WiFiWrapper {
+public:
+    int32_t getSignalStrength() const { return -67; }
+    String  getConnectionSummary() const { return "hostnet, 192.168.1.42, channel 6"; }
+};
@@ -0,0 +1,9 @@
+// esp_system.h  – host stand-in (deterministic "random")
+#pragma once
+#include <cstdint>
+
+inline uint32_t esp_random() {
+    static uint32_t x = 0x1234abcd;
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    return x;
+}
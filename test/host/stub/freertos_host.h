@@ -0,0 +1,85 @@
+// -----------------------------------------------------------------------------
+// freertos_host.h  – the FreeRTOS calls the library makes, on std::thread
+// (1 tick = 1 ms; tasks are detached threads that run until the process ends)
+// -----------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdTRUE            1
+#define pdFALSE           0
+#define pdPASS            1
+#define pdFAIL            0
+#define portMAX_DELAY     ((TickType_t)0xffffffffu)
+#define tskNO_AFFINITY    0x7fffffff
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+// ---- semaphores: mutex and recursive mutex ----------------------------------
+struct HostSemaphore_ {
+    std::recursive_timed_mutex m;
+};
+typedef HostSemaphore_* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex()          { return new HostSemaphore_(); }
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return new HostSemaphore_(); }
+inline void vSemaphoreDelete(SemaphoreHandle_t s)         { delete s; }
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+    if (ticks == portMAX_DELAY) { s->m.lock(); return pdTRUE; }
+    return s->m.try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) { s->m.unlock(); return pdTRUE; }
+#define xSemaphoreTakeRecursive xSemaphoreTake
+#define xSemaphoreGiveRecursive xSemaphoreGive
+
+// ---- tasks with direct-to-task notifications --------------------------------
+struct HostTask_ {
+    std::mutex              m;
+    std::condition_variable cv;
+    uint32_t                notified = 0;
+};
+typedef HostTask_* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+inline TaskHandle_t& hostCurrentTask_() {
+    static thread_local TaskHandle_t self = nullptr;
+    if (!self) self = new HostTask_();   // the main thread and foreign threads get one on demand
+    return self;
+}
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return hostCurrentTask_(); }
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char*, uint32_t, void* arg,
+                                          UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+    TaskHandle_t t = new HostTask_();
+    if (handle) *handle = t;
+    std::thread([fn, arg, t]() { hostCurrentTask_() = t; fn(arg); }).detach();
+    return pdPASS;
+}
+inline BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack, void* arg,
+                              UBaseType_t prio, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(fn, name, stack, arg, prio, handle, tskNO_AFFINITY);
+}
+
+inline BaseType_t xTaskNotifyGive(TaskHandle_t t) {
+    { std::lock_guard<std::mutex> l(t->m); ++t->notified; }
+    t->cv.notify_one();
+    return pdPASS;
+}
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+    TaskHandle_t t = hostCurrentTask_();
+    std::unique_lock<std::mutex> l(t->m);
+    auto ready = [t] { return t->notified != 0; };
+    if (ticks == portMAX_DELAY) t->cv.wait(l, ready);
+    else                        t->cv.wait_for(l, std::chrono::milliseconds(ticks), ready);
+    const uint32_t n = t->notified;
+    if (n) t->notified = clearOnExit ? 0 : n - 1;
+    return n;
+}
+inline void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
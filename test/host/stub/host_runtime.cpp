@@ -0,0 +1,16 @@
+// host_runtime.cpp  – the globals the Arduino core and the sketch would provide
+#include <Arduino.h>
+#include <WiFi.h>
+#include <ESP.h>
+#include <ESPmDNS.h>
+#include <LoggingBase.h>
+#include <TimeProviderBase.h>
+
+HostSerial        Serial;
+HostWiFi          WiFi;
+HostEsp           ESP;
+HostMDNS          MDNS;
+
+static LoggingBase quietLogger;
+LoggingBase*       gLogger       = &quietLogger;
+TimeProviderBase*  gTimeProvider = nullptr;
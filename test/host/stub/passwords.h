@@ -0,0 +1,7 @@
+// passwords.h  – host stand-in for the sketch's credentials header
+#pragma once
+
+namespace secret {
+    static const char* const webUser = "admin";
+    static const char* const webPass = "admin";
+}
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""
+Embeds the files in assets/ as gzip-compressed byte arrays in flash.
+
+    python3 tools/embed_assets.py
+
+writes StaticAssetsData.h / StaticAssetsData.cpp next to the library sources
+(see StaticAssets.h). Run it after editing anything in assets/ and commit the
+result - Arduino builds have no pre-build step, so the generated files are
+part of the tree. The output is reproducible (gzip mtime 0), so re-running it
+without changes leaves git clean.
+
+Each asset gets a content hash (FNV-1a over the uncompressed bytes); it is
+the strong ETag and the ?v= cache buster of versioned URLs.
+"""
+import gzip
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC  = os.path.join(ROOT, "assets")
+
+# file, symbol, content type, URL routed by StaticAssets::setupRoutes()
+# (None: the owner serves it on its own route)
+ASSETS = [
+    ("bwi.js",     "bwiJs",     "application/javascript", "/static/bwi.js"),
+    ("bwi.css",    "bwiCss",    "text/css",               "/static/bwi.css"),
+    ("status.js",  "statusJs",  "application/javascript", "/static/status.js"),
+    ("status.css", "statusCss", "text/css",               "/static/status.css"),
+    ("login.html", "loginHtml", "text/html",              None),
+    ("ota.html",   "otaHtml",   "text/html",              None),
+]
+
+HEADER = "// generated by tools/embed_assets.py from assets/ - do not edit\n"
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xffffffff
+    return h or 1
+
+
+def c_bytes(data, indent="    ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ",".join("0x%02x" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    decls, defs, routed = [], [], []
+    total_raw = total_gz = 0
+    for name, sym, ctype, url in ASSETS:
+        with open(os.path.join(SRC, name), "rb") as f:
+            raw = f.read()
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        version = "%08x" % fnv1a(raw)
+        total_raw += len(raw)
+        total_gz += len(gz)
+
+        decls.append("  extern const Asset %-11s // assets/%s" % (sym + ";", name))
+        defs.append("// assets/%s: %u -> %u bytes\n"
+                    "static const uint8_t k_%s[] PROGMEM = {\n%s\n};\n"
+                    "const StaticAssets::Asset StaticAssets::%s = {\n"
+                    "    %s, \"%s\", k_%s, sizeof(k_%s), \"\\\"%s\\\"\", \"%s\"\n};\n"
+                    % (name, len(raw), len(gz), sym, c_bytes(gz), sym,
+                       '"%s"' % url if url else "nullptr", ctype, sym, sym, version, version))
+        if url:
+            routed.append("&StaticAssets::%s" % sym)
+        print("%-11s %6u -> %5u bytes  %s" % (name, len(raw), len(gz), version))
+    print("total       %6u -> %5u bytes" % (total_raw, total_gz))
+
+    with open(os.path.join(ROOT, "StaticAssetsData.h"), "w") as f:
+        f.write(HEADER)
+        f.write("// included by StaticAssets.h\n#pragma once\n\nnamespace StaticAssets {\n")
+        f.write("\n".join(decls))
+        f.write("\n\n  /** assets with a URL, registered by setupRoutes() */\n")
+        f.write("  extern const Asset* const kRouted[];\n  extern const size_t kRoutedCount;\n}\n")
+
+    with open(os.path.join(ROOT, "StaticAssetsData.cpp"), "w") as f:
+        f.write(HEADER)
+        f.write('#include "StaticAssets.h"\n\n')
+        f.write("\n".join(defs))
+        f.write("\nconst StaticAssets::Asset* const StaticAssets::kRouted[] = {\n    %s\n};\n"
+                % ",\n    ".join(routed))
+        f.write("const size_t StaticAssets::kRoutedCount = sizeof(kRouted) / sizeof(kRouted[0]);\n")
+
+
+if __name__ == "__main__":
+    main()